@@ -0,0 +1,468 @@
+// helpers/protopirate_decoders.c
+#include "protopirate_decoders.h"
+#include "protopirate_latency.h"
+
+#include "../protocols/protocol_config.h"
+#include <lib/subghz/protocols/base.h>
+#include <flipper_format/flipper_format.h>
+#include <storage/storage.h>
+
+#define TAG "ProtoPirateDecoders"
+
+// Only compiled-in protocols can ever be loaded
+#define PROTOPIRATE_DECODERS_MAX PROTOPIRATE_PROTOCOL_COUNT
+
+// LevelDuration slots of the stream buffer in lib/subghz/subghz_worker.c
+#define PROTOPIRATE_DECODERS_WORKER_BUFFER 4096
+// Load window, ms
+#define PROTOPIRATE_DECODERS_WINDOW 1000
+// Shed a decoder at this estimated fill, percent
+#define PROTOPIRATE_DECODERS_SHED_FILL 50
+// Bring one back after this many windows below the calm fill
+#define PROTOPIRATE_DECODERS_CALM_FILL    10
+#define PROTOPIRATE_DECODERS_CALM_WINDOWS 5
+
+struct ProtoPirateDecoders {
+    SubGhzReceiver* receiver;
+    SubGhzProtocolDecoderBase* decoder[PROTOPIRATE_DECODERS_MAX];
+    uint8_t decoder_count;
+    SubGhzProtocolDecoderBase* active[PROTOPIRATE_DECODERS_MAX];
+    uint8_t active_count;
+
+    // Per loaded decoder: matches the preset, shed under load
+    bool selected[PROTOPIRATE_DECODERS_MAX];
+    bool suspended[PROTOPIRATE_DECODERS_MAX];
+    // Frames at load time, a decoder that added none is idle
+    uint32_t frames_mark[PROTOPIRATE_DECODERS_MAX];
+    // Preamble starts when the window opened, the busiest idle decoder goes first
+    uint32_t preamble_mark[PROTOPIRATE_DECODERS_MAX];
+
+    // Signal time delivered by the radio ISR, the ISR only writes these two
+    volatile uint32_t rx_us;
+    volatile uint32_t rx_glitches;
+    uint16_t glitch_filter_us;
+    // Signal time fed by the worker, rx_us - fed_us - lag_base is the backlog
+    uint32_t fed_us;
+    uint32_t lag_base;
+    uint32_t lag_window_min;
+    uint32_t lag_window_max;
+    uint32_t window_start;
+    uint32_t window_pulses;
+    uint32_t window_overruns;
+    uint8_t calm_windows;
+    ProtoPirateDecodersLoad load;
+    uint32_t fed_time;
+};
+
+static void protopirate_decoders_set_active(ProtoPirateDecoders* instance) {
+    instance->active_count = 0;
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        if(instance->selected[i] && !instance->suspended[i]) {
+            instance->active[instance->active_count++] = instance->decoder[i];
+        }
+    }
+}
+
+static void protopirate_decoders_mark(ProtoPirateDecoders* instance) {
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        ProtoPirateDecodeStats* stats = protopirate_decode_stats_get(instance->decoder[i]);
+        instance->frames_mark[i] = stats->frames;
+        instance->preamble_mark[i] = stats->preamble_starts;
+    }
+}
+
+static void protopirate_decoders_open_window(ProtoPirateDecoders* instance, uint32_t now) {
+    instance->lag_window_min = UINT32_MAX;
+    instance->lag_window_max = 0;
+    instance->window_start = now;
+    instance->window_pulses = 0;
+    instance->window_overruns = 0;
+}
+
+ProtoPirateDecoders*
+    protopirate_decoders_alloc(SubGhzReceiver* receiver, const SubGhzProtocolRegistry* registry) {
+    furi_assert(receiver);
+    furi_assert(registry);
+    ProtoPirateDecoders* instance = malloc(sizeof(ProtoPirateDecoders));
+    instance->receiver = receiver;
+    instance->decoder_count = 0;
+
+    furi_check(registry->size <= PROTOPIRATE_DECODERS_MAX);
+    for(size_t i = 0; i < registry->size; i++) {
+        const SubGhzProtocol* protocol = registry->items[i];
+        if(!(protocol->flag & SubGhzProtocolFlag_Decodable)) continue;
+        SubGhzProtocolDecoderBase* decoder =
+            subghz_receiver_search_decoder_base_by_name(receiver, protocol->name);
+        if(decoder) {
+            instance->decoder[instance->decoder_count++] = decoder;
+        }
+    }
+
+    // Until a preset is known feed everything, like the receiver filter did
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        instance->selected[i] = true;
+    }
+    protopirate_decoders_set_active(instance);
+    protopirate_decoders_mark(instance);
+    protopirate_decoders_open_window(instance, furi_get_tick());
+
+    FURI_LOG_I(TAG, "%u decoders", instance->decoder_count);
+    return instance;
+}
+
+void protopirate_decoders_free(ProtoPirateDecoders* instance) {
+    furi_assert(instance);
+    free(instance);
+}
+
+ProtoPirateModulation protopirate_decoders_get_modulation(const char* preset_name) {
+    furi_assert(preset_name);
+    if(!strncmp(preset_name, "AM", 2)) {
+        return ProtoPirateModulationAM;
+    } else if(!strncmp(preset_name, "FM", 2)) {
+        return ProtoPirateModulationFM;
+    }
+    return ProtoPirateModulationUnknown;
+}
+
+ProtoPirateBand protopirate_decoders_get_band(uint32_t frequency) {
+    if(frequency >= 300000000 && frequency <= 348000000) {
+        return ProtoPirateBand315;
+    } else if(frequency >= 387000000 && frequency <= 464000000) {
+        return ProtoPirateBand433;
+    } else if(frequency >= 779000000 && frequency <= 928000000) {
+        return ProtoPirateBand868;
+    }
+    return ProtoPirateBandUnknown;
+}
+
+static SubGhzProtocolFlag protopirate_decoders_modulation_flag(ProtoPirateModulation modulation) {
+    switch(modulation) {
+    case ProtoPirateModulationAM:
+        return SubGhzProtocolFlag_AM;
+    case ProtoPirateModulationFM:
+        return SubGhzProtocolFlag_FM;
+    default:
+        return 0;
+    }
+}
+
+static SubGhzProtocolFlag protopirate_decoders_band_flag(ProtoPirateBand band) {
+    switch(band) {
+    case ProtoPirateBand315:
+        return SubGhzProtocolFlag_315;
+    case ProtoPirateBand433:
+        return SubGhzProtocolFlag_433;
+    case ProtoPirateBand868:
+        return SubGhzProtocolFlag_868;
+    default:
+        return 0;
+    }
+}
+
+// A protocol that doesn't declare any flag of a group matches every value of it,
+// an unknown modulation or band matches every protocol
+static bool protopirate_decoders_match_group(
+    SubGhzProtocolFlag protocol_flag,
+    SubGhzProtocolFlag group_mask,
+    SubGhzProtocolFlag flag) {
+    if(!flag || !(protocol_flag & group_mask)) {
+        return true;
+    }
+    return protocol_flag & flag;
+}
+
+bool protopirate_decoders_match(
+    SubGhzProtocolFlag protocol_flag,
+    const char* preset_name,
+    uint32_t frequency) {
+    const SubGhzProtocolFlag modulation_mask = SubGhzProtocolFlag_AM | SubGhzProtocolFlag_FM;
+    const SubGhzProtocolFlag band_mask =
+        SubGhzProtocolFlag_315 | SubGhzProtocolFlag_433 | SubGhzProtocolFlag_868;
+    SubGhzProtocolFlag modulation =
+        protopirate_decoders_modulation_flag(protopirate_decoders_get_modulation(preset_name));
+    SubGhzProtocolFlag band =
+        protopirate_decoders_band_flag(protopirate_decoders_get_band(frequency));
+
+    return protopirate_decoders_match_group(protocol_flag, modulation_mask, modulation) &&
+           protopirate_decoders_match_group(protocol_flag, band_mask, band);
+}
+
+void protopirate_decoders_select(
+    ProtoPirateDecoders* instance,
+    const char* preset_name,
+    uint32_t frequency) {
+    furi_assert(instance);
+
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        instance->selected[i] = protopirate_decoders_match(
+            instance->decoder[i]->protocol->flag, preset_name, frequency);
+    }
+    // Shed decoders stay suspended across hops, the noise is still there
+    protopirate_decoders_set_active(instance);
+
+    // Whatever the worker still held was flushed with the old preset
+    instance->lag_base = instance->rx_us - instance->fed_us;
+    protopirate_decoders_open_window(instance, furi_get_tick());
+    instance->calm_windows = 0;
+
+    FURI_LOG_D(
+        TAG,
+        "%s %lu: %u/%u decoders, %u shed",
+        preset_name,
+        frequency,
+        instance->active_count,
+        instance->decoder_count,
+        instance->load.suspended);
+}
+
+uint8_t protopirate_decoders_get_active_count(ProtoPirateDecoders* instance) {
+    furi_assert(instance);
+    return instance->active_count;
+}
+
+// Suspend the idle decoder that started the most preambles, it costs the most
+static void protopirate_decoders_shed(ProtoPirateDecoders* instance) {
+    if(instance->active_count <= 1) return;
+
+    int16_t victim = -1;
+    uint32_t victim_starts = 0;
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        if(!instance->selected[i] || instance->suspended[i]) continue;
+        ProtoPirateDecodeStats* stats = protopirate_decode_stats_get(instance->decoder[i]);
+        if(stats->frames != instance->frames_mark[i]) continue;
+        uint32_t starts = stats->preamble_starts - instance->preamble_mark[i];
+        if(victim < 0 || starts > victim_starts) {
+            victim = i;
+            victim_starts = starts;
+        }
+    }
+    if(victim < 0) return;
+
+    instance->suspended[victim] = true;
+    instance->load.suspended++;
+    protopirate_decoders_set_active(instance);
+    FURI_LOG_W(
+        TAG,
+        "Load shed %s, %u active",
+        instance->decoder[victim]->protocol->name,
+        instance->active_count);
+}
+
+static void protopirate_decoders_restore(ProtoPirateDecoders* instance) {
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        if(!instance->suspended[i]) continue;
+        // Whatever it held is long stale
+        SubGhzProtocolDecoderBase* decoder = instance->decoder[i];
+        decoder->protocol->decoder->reset(decoder);
+        instance->suspended[i] = false;
+        instance->load.suspended--;
+        protopirate_decoders_set_active(instance);
+        FURI_LOG_I(TAG, "Load restored %s", decoder->protocol->name);
+        return;
+    }
+}
+
+static void protopirate_decoders_close_window(ProtoPirateDecoders* instance, uint32_t now) {
+    uint32_t elapsed = now - instance->window_start;
+    ProtoPirateDecodersLoad* load = &instance->load;
+
+    load->pulse_rate =
+        (uint64_t)instance->window_pulses * furi_kernel_get_tick_frequency() / elapsed;
+
+    // The queue drains between bursts, a floor that never went away is
+    // signal time the worker's glitch filter or an overrun dropped
+    uint32_t lag = instance->lag_window_max - instance->lag_window_min;
+    instance->lag_base += instance->lag_window_min;
+    load->lag = lag;
+    load->lag_high = MAX(load->lag_high, lag);
+
+    // Queued slots: backlog over the average pulse length of the window
+    uint32_t fill = MIN((uint64_t)lag * load->pulse_rate * 100 / 1000000 /
+                            PROTOPIRATE_DECODERS_WORKER_BUFFER,
+                        100UL);
+    load->fill_high = MAX(load->fill_high, fill);
+
+    if(instance->window_overruns || fill >= PROTOPIRATE_DECODERS_SHED_FILL) {
+        instance->calm_windows = 0;
+        protopirate_decoders_shed(instance);
+    } else if(fill < PROTOPIRATE_DECODERS_CALM_FILL && load->suspended) {
+        if(++instance->calm_windows >= PROTOPIRATE_DECODERS_CALM_WINDOWS) {
+            instance->calm_windows = 0;
+            protopirate_decoders_restore(instance);
+        }
+    } else {
+        instance->calm_windows = 0;
+    }
+
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        instance->preamble_mark[i] =
+            protopirate_decode_stats_get(instance->decoder[i])->preamble_starts;
+    }
+    protopirate_decoders_open_window(instance, now);
+}
+
+void protopirate_decoders_feed(void* context, bool level, uint32_t duration) {
+    ProtoPirateDecoders* instance = context;
+    // A frame completed by this pulse reaches the receiver callback from inside the loop
+    instance->fed_time = protopirate_latency_now();
+    for(uint8_t i = 0; i < instance->active_count; i++) {
+        SubGhzProtocolDecoderBase* decoder = instance->active[i];
+        decoder->protocol->decoder->feed(decoder, level, duration);
+    }
+
+    instance->fed_us += duration;
+    instance->window_pulses++;
+    int32_t lag = (int32_t)(instance->rx_us - instance->fed_us - instance->lag_base);
+    if(lag < 0) {
+        // Fed more than the estimate thought was queued, the base was high
+        instance->lag_base += lag;
+        lag = 0;
+    }
+    instance->lag_window_min = MIN(instance->lag_window_min, (uint32_t)lag);
+    instance->lag_window_max = MAX(instance->lag_window_max, (uint32_t)lag);
+
+    uint32_t now = furi_get_tick();
+    if(now - instance->window_start >= furi_ms_to_ticks(PROTOPIRATE_DECODERS_WINDOW)) {
+        protopirate_decoders_close_window(instance, now);
+    }
+}
+
+uint32_t protopirate_decoders_get_fed_time(ProtoPirateDecoders* instance) {
+    furi_assert(instance);
+    return instance->fed_time;
+}
+
+void protopirate_decoders_overrun(void* context) {
+    ProtoPirateDecoders* instance = context;
+    instance->load.overruns++;
+    instance->window_overruns++;
+    // Pulses are missing from the stream, no frame in progress can be trusted
+    subghz_receiver_reset(instance->receiver);
+}
+
+void protopirate_decoders_count_rx(ProtoPirateDecoders* instance, uint32_t duration) {
+    instance->rx_us += duration;
+    if(duration < instance->glitch_filter_us) {
+        instance->rx_glitches++;
+    }
+}
+
+void protopirate_decoders_set_glitch_filter(ProtoPirateDecoders* instance, uint16_t filter_us) {
+    furi_assert(instance);
+    instance->glitch_filter_us = filter_us;
+}
+
+void protopirate_decoders_get_load(ProtoPirateDecoders* instance, ProtoPirateDecodersLoad* load) {
+    furi_assert(instance);
+    furi_assert(load);
+    // Written by the worker thread, a torn copy is one window off at most
+    *load = instance->load;
+    load->glitches = instance->rx_glitches;
+    // Windows only close on pulses, a silent radio would keep the last rate
+    if(furi_get_tick() - instance->window_start >
+       furi_ms_to_ticks(PROTOPIRATE_DECODERS_WINDOW * 2)) {
+        load->pulse_rate = 0;
+        load->lag = 0;
+    }
+}
+
+uint32_t protopirate_decoders_get_fail_count(ProtoPirateDecoders* instance) {
+    furi_assert(instance);
+    uint32_t fails = 0;
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        const ProtoPirateDecodeStats* stats = protopirate_decode_stats_get(instance->decoder[i]);
+        fails += stats->checksum_fails + stats->bit_mismatches;
+    }
+    return fails;
+}
+
+uint8_t protopirate_decoders_get_count(ProtoPirateDecoders* instance) {
+    furi_assert(instance);
+    return instance->decoder_count;
+}
+
+const char* protopirate_decoders_get_stats(
+    ProtoPirateDecoders* instance,
+    uint8_t index,
+    ProtoPirateDecodeStats* stats) {
+    furi_assert(instance);
+    furi_assert(stats);
+    furi_check(index < instance->decoder_count);
+    SubGhzProtocolDecoderBase* decoder = instance->decoder[index];
+    // Written by the worker thread, a torn copy is off by one pulse at most
+    *stats = *protopirate_decode_stats_get(decoder);
+    return decoder->protocol->name;
+}
+
+void protopirate_decoders_reset_stats(ProtoPirateDecoders* instance) {
+    furi_assert(instance);
+    for(uint8_t i = 0; i < instance->decoder_count; i++) {
+        ProtoPirateDecodeStats* stats = protopirate_decode_stats_get(instance->decoder[i]);
+        memset(stats, 0, sizeof(ProtoPirateDecodeStats));
+    }
+    protopirate_decoders_mark(instance);
+
+    ProtoPirateDecodersLoad* load = &instance->load;
+    load->overruns = 0;
+    instance->rx_glitches = 0;
+    load->lag_high = 0;
+    load->fill_high = 0;
+}
+
+bool protopirate_decoders_save_stats(ProtoPirateDecoders* instance, const char* path) {
+    furi_assert(instance);
+    furi_assert(path);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    bool result = false;
+
+    do {
+        if(!flipper_format_file_open_always(flipper_format, path)) break;
+        if(!flipper_format_write_header_cstr(flipper_format, "ProtoPirate Decoder Stats", 1)) {
+            break;
+        }
+        if(!flipper_format_write_comment_cstr(
+               flipper_format,
+               "Pulses PreambleStarts PreambleAborts Frames ChecksumFails BitMismatches")) {
+            break;
+        }
+
+        result = true;
+        for(uint8_t i = 0; i < instance->decoder_count && result; i++) {
+            ProtoPirateDecodeStats stats;
+            const char* name = protopirate_decoders_get_stats(instance, i, &stats);
+            const uint32_t counters[] = {
+                stats.pulses,
+                stats.preamble_starts,
+                stats.preamble_aborts,
+                stats.frames,
+                stats.checksum_fails,
+                stats.bit_mismatches,
+            };
+            result = flipper_format_write_uint32(
+                flipper_format, name, counters, COUNT_OF(counters));
+        }
+        if(!result) break;
+
+        ProtoPirateDecodersLoad load;
+        protopirate_decoders_get_load(instance, &load);
+        const uint32_t fill_high = load.fill_high;
+        const uint32_t suspended = load.suspended;
+        result = flipper_format_write_uint32(flipper_format, "Overruns", &load.overruns, 1) &&
+                 flipper_format_write_uint32(flipper_format, "Glitches", &load.glitches, 1) &&
+                 flipper_format_write_uint32(flipper_format, "PulseRate", &load.pulse_rate, 1) &&
+                 flipper_format_write_uint32(flipper_format, "LagHigh", &load.lag_high, 1) &&
+                 flipper_format_write_uint32(flipper_format, "FillHigh", &fill_high, 1) &&
+                 flipper_format_write_uint32(flipper_format, "Suspended", &suspended, 1);
+    } while(false);
+
+    if(!result) {
+        FURI_LOG_E(TAG, "Failed to write %s", path);
+    }
+
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+    return result;
+}
@@ -0,0 +1,117 @@
+// helpers/protopirate_decoders.h
+#pragma once
+
+#include <furi.h>
+#include <lib/subghz/receiver.h>
+
+#include "../protocols/protocol_stats.h"
+
+typedef enum {
+    ProtoPirateModulationUnknown,
+    ProtoPirateModulationAM,
+    ProtoPirateModulationFM,
+} ProtoPirateModulation;
+
+typedef enum {
+    ProtoPirateBandUnknown,
+    ProtoPirateBand315,
+    ProtoPirateBand433,
+    ProtoPirateBand868,
+} ProtoPirateBand;
+
+typedef struct {
+    // Worker stream buffer overflows, each one dropped pulses
+    uint32_t overruns;
+    // Radio pulses under the glitch filter, the worker merged them into their neighbours
+    uint32_t glitches;
+    // Pairs fed per second, over the last full window
+    uint32_t pulse_rate;
+    // How far the worker runs behind the radio, last window and highest, us
+    uint32_t lag;
+    uint32_t lag_high;
+    // Highest estimated stream buffer fill, percent
+    uint8_t fill_high;
+    // Decoders currently shed to keep up
+    uint8_t suspended;
+} ProtoPirateDecodersLoad;
+
+/**
+ * Worker-side decoder dispatch.
+ *
+ * Feeds pulses only to the receiver's decoders whose modulation and band
+ * flags can match the current preset and frequency, instead of every
+ * decodable protocol. The active set must only be changed while the worker
+ * is stopped, except by the load shedding which runs on the worker itself.
+ *
+ * The worker's stream buffer is private, its fill is estimated from how
+ * much signal time the radio ISR delivered versus what the worker fed.
+ * Once a second the window is closed: when it overran or came close,
+ * the busiest idle decoder (no frame since it was loaded) is suspended,
+ * after a few calm windows the suspended ones come back.
+ */
+typedef struct ProtoPirateDecoders ProtoPirateDecoders;
+
+ProtoPirateDecoders*
+    protopirate_decoders_alloc(SubGhzReceiver* receiver, const SubGhzProtocolRegistry* registry);
+
+void protopirate_decoders_free(ProtoPirateDecoders* instance);
+
+/** Modulation family of a preset by name, "AM650" -> AM, custom presets are unknown */
+ProtoPirateModulation protopirate_decoders_get_modulation(const char* preset_name);
+
+/** Band a frequency belongs to, Hz. Out of band frequencies are unknown */
+ProtoPirateBand protopirate_decoders_get_band(uint32_t frequency);
+
+/** Whether a protocol with these flags can decode on a preset and frequency */
+bool protopirate_decoders_match(
+    SubGhzProtocolFlag protocol_flag,
+    const char* preset_name,
+    uint32_t frequency);
+
+/** Recompute the active decoder set, call on every preset or frequency change */
+void protopirate_decoders_select(
+    ProtoPirateDecoders* instance,
+    const char* preset_name,
+    uint32_t frequency);
+
+uint8_t protopirate_decoders_get_active_count(ProtoPirateDecoders* instance);
+
+/** SubGhzWorkerPairCallback */
+void protopirate_decoders_feed(void* context, bool level, uint32_t duration);
+
+/** protopirate_latency_now() stamp of the pulse being fed, for decoder callbacks */
+uint32_t protopirate_decoders_get_fed_time(ProtoPirateDecoders* instance);
+
+/** SubGhzWorkerOverrunCallback, counts the overrun and resets the decoders */
+void protopirate_decoders_overrun(void* context);
+
+/** Call from the radio RX callback before handing the pulse to the worker, ISR safe */
+void protopirate_decoders_count_rx(ProtoPirateDecoders* instance, uint32_t duration);
+
+/** Glitch filter threshold the worker runs with, us, for the glitch counter. 0 counts none */
+void protopirate_decoders_set_glitch_filter(ProtoPirateDecoders* instance, uint16_t filter_us);
+
+/** Overrun and backlog telemetry since the decoders were loaded or the stats reset */
+void protopirate_decoders_get_load(ProtoPirateDecoders* instance, ProtoPirateDecodersLoad* load);
+
+/** Frames all decoders dropped after the sync, checksum fails plus bit mismatches */
+uint32_t protopirate_decoders_get_fail_count(ProtoPirateDecoders* instance);
+
+/** Loaded decoders, active or not */
+uint8_t protopirate_decoders_get_count(ProtoPirateDecoders* instance);
+
+/**
+ * Counters of a loaded decoder, index < protopirate_decoders_get_count().
+ * They live in the decoder and restart when the protocol set is reloaded.
+ * @return protocol name
+ */
+const char* protopirate_decoders_get_stats(
+    ProtoPirateDecoders* instance,
+    uint8_t index,
+    ProtoPirateDecodeStats* stats);
+
+/** Clears the decoder counters and the load telemetry, shed decoders stay suspended */
+void protopirate_decoders_reset_stats(ProtoPirateDecoders* instance);
+
+/** Write the counters of every loaded decoder and the load telemetry to a FlipperFormat file */
+bool protopirate_decoders_save_stats(ProtoPirateDecoders* instance, const char* path);
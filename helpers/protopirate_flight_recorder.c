@@ -0,0 +1,249 @@
+// helpers/protopirate_flight_recorder.c
+#include "protopirate_flight_recorder.h"
+
+#include <lib/subghz/blocks/generic.h>
+
+#define TAG "ProtoPirateFlightRecorder"
+
+// Entry: level in bit 15, duration in us below it
+#define FLIGHT_LEVEL        0x8000
+#define FLIGHT_DURATION_MAX 0x7FFF
+// RAW_Data values per line, same as the Sub-GHz app writes
+#define FLIGHT_RAW_LINE 512
+#define FLIGHT_FILE_PREFIX   "flight_"
+#define FLIGHT_INDEX_UNKNOWN UINT32_MAX
+
+struct ProtoPirateFlightRecorder {
+    uint16_t entry[PROTOPIRATE_FLIGHT_RECORDER_SIZE];
+    // Written by the radio ISR only
+    volatile uint32_t head;
+    volatile ProtoPirateFlightTrigger pending;
+    ProtoPirateFlightRecorderMode mode;
+    uint32_t last_dump;
+    // Number of the next dump file, FLIGHT_INDEX_UNKNOWN until the folder was scanned
+    uint32_t next_index;
+};
+
+ProtoPirateFlightRecorder* protopirate_flight_recorder_alloc(void) {
+    ProtoPirateFlightRecorder* instance = malloc(sizeof(ProtoPirateFlightRecorder));
+    instance->head = 0;
+    instance->pending = ProtoPirateFlightTriggerNone;
+    instance->mode = ProtoPirateFlightRecorderModeManual;
+    instance->last_dump = furi_get_tick() - furi_ms_to_ticks(PROTOPIRATE_FLIGHT_RECORDER_HOLDOFF);
+    instance->next_index = FLIGHT_INDEX_UNKNOWN;
+    return instance;
+}
+
+void protopirate_flight_recorder_free(ProtoPirateFlightRecorder* instance) {
+    furi_assert(instance);
+    free(instance);
+}
+
+void protopirate_flight_recorder_set_mode(
+    ProtoPirateFlightRecorder* instance,
+    ProtoPirateFlightRecorderMode mode) {
+    furi_assert(instance);
+    furi_check(mode < ProtoPirateFlightRecorderModeCount);
+    instance->mode = mode;
+}
+
+ProtoPirateFlightRecorderMode
+    protopirate_flight_recorder_get_mode(ProtoPirateFlightRecorder* instance) {
+    furi_assert(instance);
+    return instance->mode;
+}
+
+void protopirate_flight_recorder_add(
+    ProtoPirateFlightRecorder* instance,
+    bool level,
+    uint32_t duration) {
+    uint32_t head = instance->head;
+    instance->entry[head & (PROTOPIRATE_FLIGHT_RECORDER_SIZE - 1)] =
+        (level ? FLIGHT_LEVEL : 0) | MIN(duration, (uint32_t)FLIGHT_DURATION_MAX);
+    instance->head = head + 1;
+}
+
+bool protopirate_flight_recorder_trigger(
+    ProtoPirateFlightRecorder* instance,
+    ProtoPirateFlightTrigger trigger) {
+    furi_assert(instance);
+
+    if(trigger != ProtoPirateFlightTriggerManual) {
+        bool allowed = (trigger == ProtoPirateFlightTriggerFail &&
+                        instance->mode >= ProtoPirateFlightRecorderModeFails) ||
+                       (trigger == ProtoPirateFlightTriggerDecode &&
+                        instance->mode >= ProtoPirateFlightRecorderModeAll);
+        if(!allowed || instance->pending != ProtoPirateFlightTriggerNone ||
+           furi_get_tick() - instance->last_dump <
+               furi_ms_to_ticks(PROTOPIRATE_FLIGHT_RECORDER_HOLDOFF)) {
+            return false;
+        }
+    }
+
+    instance->pending = trigger;
+    return true;
+}
+
+ProtoPirateFlightTrigger
+    protopirate_flight_recorder_get_pending(ProtoPirateFlightRecorder* instance) {
+    furi_assert(instance);
+    return instance->pending;
+}
+
+// One past the highest flight_NNN already in the folder
+static uint32_t protopirate_flight_recorder_scan_index(Storage* storage) {
+    File* dir = storage_file_alloc(storage);
+    FileInfo file_info;
+    char name[64];
+    uint32_t next_index = 0;
+
+    if(storage_dir_open(dir, PROTOPIRATE_FLIGHT_RECORDER_FOLDER)) {
+        while(storage_dir_read(dir, &file_info, name, sizeof(name))) {
+            if(file_info_is_dir(&file_info) ||
+               strncmp(name, FLIGHT_FILE_PREFIX, strlen(FLIGHT_FILE_PREFIX))) {
+                continue;
+            }
+            uint32_t index = strtoul(name + strlen(FLIGHT_FILE_PREFIX), NULL, 10);
+            if(index >= next_index && index < FLIGHT_INDEX_UNKNOWN) {
+                next_index = index + 1;
+            }
+        }
+    }
+
+    storage_dir_close(dir);
+    storage_file_free(dir);
+    return next_index;
+}
+
+// The folder is listed once, later dumps just take the next number
+static bool protopirate_flight_recorder_get_path(
+    ProtoPirateFlightRecorder* instance,
+    FuriString* path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    storage_simply_mkdir(storage, PROTOPIRATE_FLIGHT_RECORDER_FOLDER);
+    if(instance->next_index == FLIGHT_INDEX_UNKNOWN) {
+        instance->next_index = protopirate_flight_recorder_scan_index(storage);
+    }
+    furi_string_printf(
+        path,
+        "%s/" FLIGHT_FILE_PREFIX "%03lu%s",
+        PROTOPIRATE_FLIGHT_RECORDER_FOLDER,
+        instance->next_index,
+        PROTOPIRATE_APP_EXTENSION);
+    bool found = instance->next_index != FLIGHT_INDEX_UNKNOWN;
+    if(found) {
+        instance->next_index++;
+    }
+
+    furi_record_close(RECORD_STORAGE);
+    return found;
+}
+
+// Signed RAW values, consecutive durations of one level add up
+static bool protopirate_flight_recorder_write_raw(
+    FlipperFormat* flipper_format,
+    const uint16_t* entry,
+    uint32_t count) {
+    int32_t* line = malloc(sizeof(int32_t) * FLIGHT_RAW_LINE);
+    uint32_t length = 0;
+    bool result = true;
+
+    for(uint32_t i = 0; i < count && result; i++) {
+        bool level = entry[i] & FLIGHT_LEVEL;
+        int32_t duration = entry[i] & FLIGHT_DURATION_MAX;
+        int32_t value = level ? duration : -duration;
+
+        if(length && ((line[length - 1] > 0) == level)) {
+            line[length - 1] += value;
+            continue;
+        }
+        if(length == FLIGHT_RAW_LINE) {
+            result = flipper_format_write_int32(flipper_format, "RAW_Data", line, length);
+            length = 0;
+        }
+        line[length++] = value;
+    }
+    if(result && length) {
+        result = flipper_format_write_int32(flipper_format, "RAW_Data", line, length);
+    }
+
+    free(line);
+    return result;
+}
+
+bool protopirate_flight_recorder_dump(
+    ProtoPirateFlightRecorder* instance,
+    const SubGhzRadioPreset* preset,
+    FuriString* out_path) {
+    furi_assert(instance);
+    furi_assert(preset);
+    furi_assert(out_path);
+
+    // Oldest first, the ISR keeps writing while this copies
+    uint16_t* entry = malloc(sizeof(instance->entry));
+    uint32_t head = instance->head;
+    uint32_t first = head > PROTOPIRATE_FLIGHT_RECORDER_SIZE ?
+                         head - PROTOPIRATE_FLIGHT_RECORDER_SIZE :
+                         0;
+    for(uint32_t slot = first; slot < head; slot++) {
+        entry[slot - first] = instance->entry[slot & (PROTOPIRATE_FLIGHT_RECORDER_SIZE - 1)];
+    }
+    // Oldest slots the ISR reused during the copy hold newer pulses, skip them
+    uint32_t after = instance->head;
+    uint32_t skip = after - first > PROTOPIRATE_FLIGHT_RECORDER_SIZE ?
+                        MIN(after - first - PROTOPIRATE_FLIGHT_RECORDER_SIZE, head - first) :
+                        0;
+
+    instance->last_dump = furi_get_tick();
+    instance->pending = ProtoPirateFlightTriggerNone;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    FuriString* preset_name = furi_string_alloc();
+    bool result = false;
+
+    do {
+        if(!protopirate_storage_init()) break;
+        if(!protopirate_flight_recorder_get_path(instance, out_path)) break;
+        if(!flipper_format_file_open_always(
+               flipper_format, furi_string_get_cstr(out_path))) {
+            break;
+        }
+        if(!flipper_format_write_header_cstr(flipper_format, "Flipper SubGhz RAW File", 1)) {
+            break;
+        }
+        if(!flipper_format_write_uint32(flipper_format, "Frequency", &preset->frequency, 1)) {
+            break;
+        }
+
+        subghz_block_generic_get_preset_name(furi_string_get_cstr(preset->name), preset_name);
+        if(!flipper_format_write_string(flipper_format, "Preset", preset_name)) break;
+        if(!furi_string_cmp_str(preset_name, "FuriHalSubGhzPresetCustom")) {
+            if(!flipper_format_write_string_cstr(
+                   flipper_format, "Custom_preset_module", "CC1101")) {
+                break;
+            }
+            if(!flipper_format_write_hex(
+                   flipper_format, "Custom_preset_data", preset->data, preset->data_size)) {
+                break;
+            }
+        }
+        if(!flipper_format_write_string_cstr(flipper_format, "Protocol", "RAW")) break;
+
+        result = protopirate_flight_recorder_write_raw(
+            flipper_format, entry + skip, head - first - skip);
+    } while(false);
+
+    if(result) {
+        FURI_LOG_I(TAG, "%lu pulses to %s", head - first - skip, furi_string_get_cstr(out_path));
+    } else {
+        FURI_LOG_E(TAG, "Dump failed");
+    }
+
+    furi_string_free(preset_name);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+    free(entry);
+    return result;
+}
@@ -0,0 +1,79 @@
+// helpers/protopirate_flight_recorder.h
+#pragma once
+
+#include <furi.h>
+#include <lib/subghz/types.h>
+
+#include "protopirate_storage.h"
+
+// Pulses kept, a power of two. A few seconds of key fob bursts, less in heavy noise
+#define PROTOPIRATE_FLIGHT_RECORDER_SIZE    4096
+#define PROTOPIRATE_FLIGHT_RECORDER_FOLDER  PROTOPIRATE_APP_FOLDER "/flight"
+// Automatic triggers are ignored this long after a dump, ms
+#define PROTOPIRATE_FLIGHT_RECORDER_HOLDOFF 5000
+
+typedef enum {
+    // Long OK in the receiver only
+    ProtoPirateFlightRecorderModeManual,
+    // Also frames a decoder dropped after the sync, on a checksum or bit count
+    ProtoPirateFlightRecorderModeFails,
+    // Also every decoded frame
+    ProtoPirateFlightRecorderModeAll,
+    ProtoPirateFlightRecorderModeCount,
+} ProtoPirateFlightRecorderMode;
+
+typedef enum {
+    ProtoPirateFlightTriggerNone,
+    ProtoPirateFlightTriggerManual,
+    ProtoPirateFlightTriggerFail,
+    ProtoPirateFlightTriggerDecode,
+} ProtoPirateFlightTrigger;
+
+/**
+ * Pulse flight recorder.
+ *
+ * Keeps the last PROTOPIRATE_FLIGHT_RECORDER_SIZE pulses the radio handed
+ * to the worker, 2 bytes each, so a frame that failed in the field can be
+ * replayed later: a trigger marks a dump pending and the UI thread writes
+ * the ring as a Flipper SubGhz RAW file, which the sim radio and the host
+ * tools read back.
+ */
+typedef struct ProtoPirateFlightRecorder ProtoPirateFlightRecorder;
+
+ProtoPirateFlightRecorder* protopirate_flight_recorder_alloc(void);
+void protopirate_flight_recorder_free(ProtoPirateFlightRecorder* instance);
+
+void protopirate_flight_recorder_set_mode(
+    ProtoPirateFlightRecorder* instance,
+    ProtoPirateFlightRecorderMode mode);
+ProtoPirateFlightRecorderMode
+    protopirate_flight_recorder_get_mode(ProtoPirateFlightRecorder* instance);
+
+/** Radio RX callback tap, ISR safe. Durations above 32767 us are clipped */
+void protopirate_flight_recorder_add(
+    ProtoPirateFlightRecorder* instance,
+    bool level,
+    uint32_t duration);
+
+/**
+ * Ask for a dump, from any thread. Automatic triggers only count when the
+ * mode allows them and the holdoff since the last dump is over.
+ * @return true if a dump is now pending
+ */
+bool protopirate_flight_recorder_trigger(
+    ProtoPirateFlightRecorder* instance,
+    ProtoPirateFlightTrigger trigger);
+
+ProtoPirateFlightTrigger
+    protopirate_flight_recorder_get_pending(ProtoPirateFlightRecorder* instance);
+
+/**
+ * Write the ring oldest first as a RAW .sub in PROTOPIRATE_FLIGHT_RECORDER_FOLDER
+ * and clear the pending trigger. Slow, UI thread only.
+ * @param preset tuning written to the file, the current one: pulses from
+ *               earlier hops are labelled with it too
+ */
+bool protopirate_flight_recorder_dump(
+    ProtoPirateFlightRecorder* instance,
+    const SubGhzRadioPreset* preset,
+    FuriString* out_path);
@@ -0,0 +1,79 @@
+// helpers/protopirate_hopper_stats.c
+#include "protopirate_hopper_stats.h"
+
+// A fresh channel triggers at -90 dBm, same as the old fixed threshold
+#define HOPPER_FLOOR_INITIAL  -100.0f
+#define HOPPER_FLOOR_MARGIN   10.0f
+#define HOPPER_RSSI_MIN       -127.0f
+// Floor tracking: quiet samples pull the floor down fast and up slowly,
+// active samples creep it up so a constant carrier can't hold a channel
+#define HOPPER_FLOOR_FALL     0.125f
+#define HOPPER_FLOOR_RISE     0.015625f
+#define HOPPER_FLOOR_CREEP    0.001953125f
+#define HOPPER_ACTIVITY_RSSI   1.0f
+#define HOPPER_ACTIVITY_DECODE 4.0f
+#define HOPPER_ACTIVITY_DECAY  0.9f
+
+void protopirate_hopper_stats_reset(ProtoPirateHopperStats* stats, uint8_t channel_count) {
+    furi_assert(stats);
+    stats->channel_count = MIN(channel_count, PROTOPIRATE_HOPPER_CHANNEL_MAX);
+    for(uint8_t i = 0; i < PROTOPIRATE_HOPPER_CHANNEL_MAX; i++) {
+        ProtoPirateHopperChannelStats* ch = &stats->channel[i];
+        ch->noise_floor = HOPPER_FLOOR_INITIAL;
+        ch->rssi_peak = HOPPER_RSSI_MIN;
+        ch->activity = 0.0f;
+        ch->decode_hits = 0;
+        ch->last_activity = 0;
+    }
+}
+
+bool protopirate_hopper_stats_add_rssi(
+    ProtoPirateHopperStats* stats,
+    uint8_t idx,
+    float rssi,
+    uint32_t tick) {
+    furi_assert(stats);
+    if(idx >= stats->channel_count) return false;
+    ProtoPirateHopperChannelStats* ch = &stats->channel[idx];
+
+    bool active = rssi > ch->noise_floor + HOPPER_FLOOR_MARGIN;
+    if(active) {
+        ch->noise_floor += (rssi - ch->noise_floor) * HOPPER_FLOOR_CREEP;
+        ch->activity += HOPPER_ACTIVITY_RSSI;
+        ch->last_activity = tick;
+    } else if(rssi < ch->noise_floor) {
+        ch->noise_floor += (rssi - ch->noise_floor) * HOPPER_FLOOR_FALL;
+    } else {
+        ch->noise_floor += (rssi - ch->noise_floor) * HOPPER_FLOOR_RISE;
+    }
+
+    if(rssi > ch->rssi_peak) ch->rssi_peak = rssi;
+
+    return active;
+}
+
+void protopirate_hopper_stats_add_decode(ProtoPirateHopperStats* stats, uint8_t idx, uint32_t tick) {
+    furi_assert(stats);
+    if(idx >= stats->channel_count) return;
+    ProtoPirateHopperChannelStats* ch = &stats->channel[idx];
+
+    if(ch->decode_hits < UINT16_MAX) ch->decode_hits++;
+    ch->activity += HOPPER_ACTIVITY_DECODE;
+    ch->last_activity = tick;
+}
+
+float protopirate_hopper_stats_get_threshold(ProtoPirateHopperStats* stats, uint8_t idx) {
+    furi_assert(stats);
+    if(idx >= stats->channel_count) return HOPPER_FLOOR_INITIAL + HOPPER_FLOOR_MARGIN;
+    return stats->channel[idx].noise_floor + HOPPER_FLOOR_MARGIN;
+}
+
+uint8_t protopirate_hopper_stats_enter(ProtoPirateHopperStats* stats, uint8_t idx) {
+    furi_assert(stats);
+    if(idx >= stats->channel_count) return 1;
+    ProtoPirateHopperChannelStats* ch = &stats->channel[idx];
+
+    ch->activity *= HOPPER_ACTIVITY_DECAY;
+    uint32_t dwell = 1 + (uint32_t)ch->activity;
+    return MIN(dwell, (uint32_t)PROTOPIRATE_HOPPER_DWELL_MAX);
+}
@@ -0,0 +1,43 @@
+// helpers/protopirate_hopper_stats.h
+#pragma once
+
+#include <furi.h>
+
+#define PROTOPIRATE_HOPPER_CHANNEL_MAX 32
+#define PROTOPIRATE_HOPPER_DWELL_MAX   8
+
+typedef struct {
+    float noise_floor;
+    float rssi_peak;
+    float activity;
+    uint16_t decode_hits;
+    uint32_t last_activity;
+} ProtoPirateHopperChannelStats;
+
+typedef struct {
+    ProtoPirateHopperChannelStats channel[PROTOPIRATE_HOPPER_CHANNEL_MAX];
+    uint8_t channel_count;
+} ProtoPirateHopperStats;
+
+void protopirate_hopper_stats_reset(ProtoPirateHopperStats* stats, uint8_t channel_count);
+
+/**
+ * Account one RSSI sample on a channel and update its noise floor.
+ * @return true when the sample stands out of the channel noise floor
+ */
+bool protopirate_hopper_stats_add_rssi(
+    ProtoPirateHopperStats* stats,
+    uint8_t idx,
+    float rssi,
+    uint32_t tick);
+
+void protopirate_hopper_stats_add_decode(ProtoPirateHopperStats* stats, uint8_t idx, uint32_t tick);
+
+/** Detection threshold currently in use for a channel, dBm */
+float protopirate_hopper_stats_get_threshold(ProtoPirateHopperStats* stats, uint8_t idx);
+
+/**
+ * Start a visit on a channel, ages its activity score.
+ * @return ticks to stay on the channel, proportional to observed activity
+ */
+uint8_t protopirate_hopper_stats_enter(ProtoPirateHopperStats* stats, uint8_t idx);
@@ -0,0 +1,184 @@
+// helpers/protopirate_latency.c
+#include "protopirate_latency.h"
+
+#include <flipper_format/flipper_format.h>
+#include <storage/storage.h>
+
+#define TAG "ProtoPirateLatency"
+
+struct ProtoPirateLatency {
+    FuriMutex* mutex;
+    ProtoPirateLatencyHistogram histogram[ProtoPirateLatencyStageCount];
+    uint32_t fed;
+    uint32_t callback;
+    uint32_t stored;
+    // Read without the mutex by every draw
+    volatile bool pending;
+};
+
+static const char* const protopirate_latency_stage_name[ProtoPirateLatencyStageCount] = {
+    [ProtoPirateLatencyStageDecode] = "Decode",
+    [ProtoPirateLatencyStageHistory] = "History",
+    [ProtoPirateLatencyStageDisplay] = "Display",
+    [ProtoPirateLatencyStageTotal] = "Total",
+};
+
+static uint8_t protopirate_latency_get_bin(uint32_t us) {
+    uint8_t bin = us ? 32 - __builtin_clz(us) : 0;
+    return MIN(bin, PROTOPIRATE_LATENCY_BINS - 1);
+}
+
+// Caller holds the mutex
+static void protopirate_latency_add(
+    ProtoPirateLatency* instance,
+    ProtoPirateLatencyStage stage,
+    uint32_t from,
+    uint32_t to) {
+    uint32_t us = (to - from) / furi_hal_cortex_instructions_per_microsecond();
+    ProtoPirateLatencyHistogram* histogram = &instance->histogram[stage];
+
+    histogram->bin[protopirate_latency_get_bin(us)]++;
+    histogram->min = histogram->count ? MIN(histogram->min, us) : us;
+    histogram->max = MAX(histogram->max, us);
+    histogram->sum += us;
+    histogram->count++;
+}
+
+ProtoPirateLatency* protopirate_latency_alloc(void) {
+    ProtoPirateLatency* instance = malloc(sizeof(ProtoPirateLatency));
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    protopirate_latency_reset(instance);
+    return instance;
+}
+
+void protopirate_latency_free(ProtoPirateLatency* instance) {
+    furi_assert(instance);
+    furi_mutex_free(instance->mutex);
+    free(instance);
+}
+
+void protopirate_latency_reset(ProtoPirateLatency* instance) {
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    memset(instance->histogram, 0, sizeof(instance->histogram));
+    instance->pending = false;
+    furi_mutex_release(instance->mutex);
+}
+
+void protopirate_latency_begin(ProtoPirateLatency* instance, uint32_t fed) {
+    furi_assert(instance);
+    uint32_t now = protopirate_latency_now();
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    instance->fed = fed;
+    instance->callback = now;
+    furi_mutex_release(instance->mutex);
+}
+
+void protopirate_latency_stored(ProtoPirateLatency* instance, uint32_t stored) {
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    instance->stored = stored;
+    protopirate_latency_add(
+        instance, ProtoPirateLatencyStageDecode, instance->fed, instance->callback);
+    protopirate_latency_add(instance, ProtoPirateLatencyStageHistory, instance->callback, stored);
+    instance->pending = true;
+    furi_mutex_release(instance->mutex);
+}
+
+void protopirate_latency_drawn(ProtoPirateLatency* instance) {
+    furi_assert(instance);
+    if(!instance->pending) return;
+
+    uint32_t now = protopirate_latency_now();
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    if(instance->pending) {
+        protopirate_latency_add(instance, ProtoPirateLatencyStageDisplay, instance->stored, now);
+        protopirate_latency_add(instance, ProtoPirateLatencyStageTotal, instance->fed, now);
+        instance->pending = false;
+    }
+    furi_mutex_release(instance->mutex);
+}
+
+void protopirate_latency_cancel(ProtoPirateLatency* instance) {
+    furi_assert(instance);
+    instance->pending = false;
+}
+
+const char* protopirate_latency_get_stage_name(ProtoPirateLatencyStage stage) {
+    furi_check(stage < ProtoPirateLatencyStageCount);
+    return protopirate_latency_stage_name[stage];
+}
+
+void protopirate_latency_get_histogram(
+    ProtoPirateLatency* instance,
+    ProtoPirateLatencyStage stage,
+    ProtoPirateLatencyHistogram* histogram) {
+    furi_assert(instance);
+    furi_assert(histogram);
+    furi_check(stage < ProtoPirateLatencyStageCount);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    *histogram = instance->histogram[stage];
+    furi_mutex_release(instance->mutex);
+}
+
+uint32_t protopirate_latency_get_percentile(
+    const ProtoPirateLatencyHistogram* histogram,
+    uint8_t percent) {
+    furi_assert(histogram);
+    if(!histogram->count) return 0;
+
+    // Rank of the sample, rounded up so p100 is the last one
+    uint32_t rank = ((uint64_t)histogram->count * percent + 99) / 100;
+    uint32_t seen = 0;
+    for(uint8_t i = 0; i < PROTOPIRATE_LATENCY_BINS - 1; i++) {
+        seen += histogram->bin[i];
+        if(seen >= MAX(rank, 1UL)) {
+            // The max is tighter than the bin edge for the top bin
+            return MIN(1UL << i, histogram->max);
+        }
+    }
+    return histogram->max;
+}
+
+bool protopirate_latency_save(ProtoPirateLatency* instance, const char* path) {
+    furi_assert(instance);
+    furi_assert(path);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    bool result = false;
+
+    do {
+        if(!flipper_format_file_open_always(flipper_format, path)) break;
+        if(!flipper_format_write_header_cstr(flipper_format, "ProtoPirate Latency", 1)) break;
+        if(!flipper_format_write_comment_cstr(
+               flipper_format,
+               "Count Min Max Mean us, then bins: n counts [2^(n-1), 2^n) us")) {
+            break;
+        }
+
+        result = true;
+        for(uint8_t stage = 0; stage < ProtoPirateLatencyStageCount && result; stage++) {
+            ProtoPirateLatencyHistogram histogram;
+            protopirate_latency_get_histogram(instance, stage, &histogram);
+
+            uint32_t values[4 + PROTOPIRATE_LATENCY_BINS] = {
+                histogram.count,
+                histogram.min,
+                histogram.max,
+                histogram.count ? histogram.sum / histogram.count : 0,
+            };
+            memcpy(&values[4], histogram.bin, sizeof(histogram.bin));
+            result = flipper_format_write_uint32(
+                flipper_format, protopirate_latency_stage_name[stage], values, COUNT_OF(values));
+        }
+    } while(false);
+
+    if(!result) {
+        FURI_LOG_E(TAG, "Failed to write %s", path);
+    }
+
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+    return result;
+}
@@ -0,0 +1,77 @@
+// helpers/protopirate_latency.h
+#pragma once
+
+#include <furi.h>
+#include <furi_hal.h>
+
+// Bin n counts latencies in [2^(n-1), 2^n) us, bin 0 is under 1 us, the last is open ended
+#define PROTOPIRATE_LATENCY_BINS 24
+
+typedef enum {
+    // Worker fed the pulse that completed the frame -> receiver callback
+    ProtoPirateLatencyStageDecode,
+    // Receiver callback -> item stored in the history
+    ProtoPirateLatencyStageHistory,
+    // Stored -> first receiver view draw after it
+    ProtoPirateLatencyStageDisplay,
+    // Completing pulse -> on screen
+    ProtoPirateLatencyStageTotal,
+    ProtoPirateLatencyStageCount,
+} ProtoPirateLatencyStage;
+
+typedef struct {
+    uint32_t bin[PROTOPIRATE_LATENCY_BINS];
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} ProtoPirateLatencyHistogram;
+
+/**
+ * Decode-to-screen latency tracing.
+ *
+ * The worker stamps the pulse it feeds and the receiver callback, the
+ * stored frame then stays pending until the receiver view draws it. Only
+ * frames that reach the history are traced, one at a time: a frame stored
+ * before the previous one was drawn replaces it.
+ */
+typedef struct ProtoPirateLatency ProtoPirateLatency;
+
+/** Cycle counter stamp, for protopirate_latency_begin() */
+static inline uint32_t protopirate_latency_now(void) {
+    return DWT->CYCCNT;
+}
+
+ProtoPirateLatency* protopirate_latency_alloc(void);
+void protopirate_latency_free(ProtoPirateLatency* instance);
+void protopirate_latency_reset(ProtoPirateLatency* instance);
+
+/** Receiver callback entry, fed is the stamp taken when the completing pulse was fed */
+void protopirate_latency_begin(ProtoPirateLatency* instance, uint32_t fed);
+
+/**
+ * The frame from the last begin made it into the history at the stored stamp.
+ * Call once the receiver view holds the item, the next draw closes it.
+ */
+void protopirate_latency_stored(ProtoPirateLatency* instance, uint32_t stored);
+
+/** Receiver view draw, closes the pending frame */
+void protopirate_latency_drawn(ProtoPirateLatency* instance);
+
+/** Drop the pending frame, e.g. when the receiver view goes away */
+void protopirate_latency_cancel(ProtoPirateLatency* instance);
+
+const char* protopirate_latency_get_stage_name(ProtoPirateLatencyStage stage);
+
+void protopirate_latency_get_histogram(
+    ProtoPirateLatency* instance,
+    ProtoPirateLatencyStage stage,
+    ProtoPirateLatencyHistogram* histogram);
+
+/** Upper bound of the bin holding the given percentile, us. 0 when empty */
+uint32_t protopirate_latency_get_percentile(
+    const ProtoPirateLatencyHistogram* histogram,
+    uint8_t percent);
+
+/** Write every stage histogram to a FlipperFormat file */
+bool protopirate_latency_save(ProtoPirateLatency* instance, const char* path);
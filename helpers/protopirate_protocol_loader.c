@@ -0,0 +1,191 @@
+// helpers/protopirate_protocol_loader.c
+#include "protopirate_protocol_loader.h"
+#include "../protocols/protocol_items.h"
+
+#ifdef PROTOPIRATE_PROTOCOL_PLUGINS
+#include "../plugins/protopirate_protocol_plugin.h"
+#include <flipper_application/plugins/plugin_manager.h>
+#include <loader/firmware_api/firmware_api.h>
+#endif
+
+#define TAG "ProtoPirateProtocolLoader"
+
+const ProtoPirateProtocolManifest protopirate_protocol_manifest[] = {
+#define PROTOPIRATE_PROTOCOL(protocol, plugin_id, protocol_name, protocol_flag, short_us, long_us) \
+    {                                                                                               \
+        .name = protocol_name,                                                                      \
+        .plugin = plugin_id,                                                                        \
+        .flag = protocol_flag,                                                                      \
+        .te_short = short_us,                                                                       \
+        .te_long = long_us,                                                                         \
+    },
+#include "../protocols/protocol_list.h"
+#undef PROTOPIRATE_PROTOCOL
+};
+
+const size_t protopirate_protocol_manifest_count = COUNT_OF(protopirate_protocol_manifest);
+
+_Static_assert(
+    PROTOPIRATE_PROTOCOL_COUNT <= PROTOPIRATE_PROTOCOL_MANIFEST_MAX,
+    "Protocol masks are 32 bit");
+
+struct ProtoPirateProtocolLoader {
+#ifdef PROTOPIRATE_PROTOCOL_PLUGINS
+    PluginManager* manager;
+#endif
+    const SubGhzProtocol* items[PROTOPIRATE_PROTOCOL_COUNT];
+    SubGhzProtocolRegistry registry;
+    uint32_t loaded;
+    // Entries that failed to load or to match the manifest, never retried
+    uint32_t failed;
+};
+
+int32_t protopirate_protocol_manifest_find(const char* name) {
+    furi_assert(name);
+    for(size_t i = 0; i < protopirate_protocol_manifest_count; i++) {
+        if(!strcmp(protopirate_protocol_manifest[i].name, name)) {
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
+
+ProtoPirateProtocolLoader* protopirate_protocol_loader_alloc(void) {
+    ProtoPirateProtocolLoader* instance = malloc(sizeof(ProtoPirateProtocolLoader));
+#ifdef PROTOPIRATE_PROTOCOL_PLUGINS
+    instance->manager = NULL;
+#endif
+    instance->registry.items = instance->items;
+    instance->registry.size = 0;
+    instance->loaded = 0;
+    instance->failed = 0;
+    return instance;
+}
+
+void protopirate_protocol_loader_free(ProtoPirateProtocolLoader* instance) {
+    furi_assert(instance);
+#ifdef PROTOPIRATE_PROTOCOL_PLUGINS
+    if(instance->manager) {
+        plugin_manager_free(instance->manager);
+    }
+#endif
+    free(instance);
+}
+
+#ifdef PROTOPIRATE_PROTOCOL_PLUGINS
+static const ProtoPirateProtocolPlugin*
+    protopirate_protocol_loader_load_one(ProtoPirateProtocolLoader* instance, size_t index) {
+    char path[64];
+    snprintf(
+        path,
+        sizeof(path),
+        "%s/%s.fal",
+        PROTOPIRATE_PLUGIN_PATH,
+        protopirate_protocol_manifest[index].plugin);
+
+    PluginManagerError error = plugin_manager_load_single(instance->manager, path);
+    if(error != PluginManagerErrorNone) {
+        FURI_LOG_E(TAG, "Failed to load %s: %d", path, error);
+        return NULL;
+    }
+    return plugin_manager_get_ep(
+        instance->manager, plugin_manager_get_count(instance->manager) - 1);
+}
+#else
+// Linked-in timings, in manifest order like the registry
+static const SubGhzBlockConst* const protopirate_protocol_timing[] = {
+#define PROTOPIRATE_PROTOCOL(protocol, plugin_id, protocol_name, protocol_flag, short_us, long_us) \
+    &protocol##_const,
+#include "../protocols/protocol_list.h"
+#undef PROTOPIRATE_PROTOCOL
+};
+#endif
+
+// The app picks decoders by the manifest before loading them, a stale .fal
+// left on the SD card would silently sit on the wrong frequencies or timings
+static bool protopirate_protocol_loader_check(
+    size_t index,
+    const SubGhzProtocol* protocol,
+    const SubGhzBlockConst* timing) {
+    const ProtoPirateProtocolManifest* manifest = &protopirate_protocol_manifest[index];
+    if(strcmp(protocol->name, manifest->name) != 0 || protocol->flag != manifest->flag ||
+       timing->te_short != manifest->te_short || timing->te_long != manifest->te_long) {
+        FURI_LOG_E(
+            TAG,
+            "Manifest entry %zu is %s %lx %u/%u, got %s %lx %u/%u",
+            index,
+            manifest->name,
+            (uint32_t)manifest->flag,
+            manifest->te_short,
+            manifest->te_long,
+            protocol->name,
+            (uint32_t)protocol->flag,
+            timing->te_short,
+            timing->te_long);
+        return false;
+    }
+    return true;
+}
+
+void protopirate_protocol_loader_load(ProtoPirateProtocolLoader* instance, uint32_t mask) {
+    furi_assert(instance);
+
+#ifdef PROTOPIRATE_PROTOCOL_PLUGINS
+    // Plugins can't be unloaded one by one, start over with a fresh manager
+    if(instance->manager) {
+        plugin_manager_free(instance->manager);
+    }
+    instance->manager = plugin_manager_alloc(
+        PROTOPIRATE_PLUGIN_APP_ID, PROTOPIRATE_PLUGIN_API_VERSION, firmware_api_interface);
+#endif
+
+    instance->registry.size = 0;
+    instance->loaded = 0;
+    for(size_t i = 0; i < protopirate_protocol_manifest_count; i++) {
+        if(!(mask & (1UL << i)) || (instance->failed & (1UL << i))) continue;
+
+#ifdef PROTOPIRATE_PROTOCOL_PLUGINS
+        const ProtoPirateProtocolPlugin* plugin =
+            protopirate_protocol_loader_load_one(instance, i);
+        if(!plugin) {
+            instance->failed |= 1UL << i;
+            continue;
+        }
+        const SubGhzProtocol* protocol = plugin->protocol;
+        const SubGhzBlockConst* timing = plugin->timing;
+#else
+        // Linked-in registry is in manifest order
+        const SubGhzProtocol* protocol = protopirate_protocol_registry.items[i];
+        const SubGhzBlockConst* timing = protopirate_protocol_timing[i];
+#endif
+        // Skipped like a plugin that failed to load, the manifest can't be trusted for it
+        if(!protopirate_protocol_loader_check(i, protocol, timing)) {
+            instance->failed |= 1UL << i;
+            continue;
+        }
+        instance->items[instance->registry.size++] = protocol;
+        instance->loaded |= 1UL << i;
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "%zu/%zu protocols loaded",
+        instance->registry.size,
+        protopirate_protocol_manifest_count);
+}
+
+uint32_t protopirate_protocol_loader_get_loaded(ProtoPirateProtocolLoader* instance) {
+    furi_assert(instance);
+    return instance->loaded;
+}
+
+uint32_t protopirate_protocol_loader_get_failed(ProtoPirateProtocolLoader* instance) {
+    furi_assert(instance);
+    return instance->failed;
+}
+
+const SubGhzProtocolRegistry*
+    protopirate_protocol_loader_get_registry(ProtoPirateProtocolLoader* instance) {
+    furi_assert(instance);
+    return &instance->registry;
+}
@@ -0,0 +1,57 @@
+// helpers/protopirate_protocol_loader.h
+#pragma once
+
+#include <furi.h>
+#include <lib/subghz/types.h>
+
+#include "../protocols/protocol_config.h"
+
+/** Manifest bitmasks are uint32_t */
+#define PROTOPIRATE_PROTOCOL_MANIFEST_MAX 32
+
+/**
+ * Resident description of a decoder, known before the decoder is loaded.
+ * Generated from protocols/protocol_list.h.
+ */
+typedef struct {
+    const char* name;
+    const char* plugin;
+    SubGhzProtocolFlag flag;
+    uint16_t te_short;
+    uint16_t te_long;
+} ProtoPirateProtocolManifest;
+
+extern const ProtoPirateProtocolManifest protopirate_protocol_manifest[];
+extern const size_t protopirate_protocol_manifest_count;
+
+/** Manifest index of a protocol, -1 if unknown */
+int32_t protopirate_protocol_manifest_find(const char* name);
+
+/**
+ * Keeps the registry the receiver is built from.
+ *
+ * With PROTOPIRATE_PROTOCOL_PLUGINS every decoder is a .fal plugin in the
+ * app data folder and only the selected ones are loaded into RAM, otherwise
+ * the registry is a subset of the linked-in decoders.
+ */
+typedef struct ProtoPirateProtocolLoader ProtoPirateProtocolLoader;
+
+ProtoPirateProtocolLoader* protopirate_protocol_loader_alloc(void);
+void protopirate_protocol_loader_free(ProtoPirateProtocolLoader* instance);
+
+/**
+ * Replace the loaded set with the protocols in mask, bit n is manifest entry n.
+ * Protocols of the previous set become invalid. A plugin that fails to load,
+ * or doesn't match its manifest entry, is logged once and skipped by every
+ * later load.
+ */
+void protopirate_protocol_loader_load(ProtoPirateProtocolLoader* instance, uint32_t mask);
+
+/** Manifest bitmask of the protocols actually loaded */
+uint32_t protopirate_protocol_loader_get_loaded(ProtoPirateProtocolLoader* instance);
+
+/** Manifest bitmask of the plugins that failed to load */
+uint32_t protopirate_protocol_loader_get_failed(ProtoPirateProtocolLoader* instance);
+
+const SubGhzProtocolRegistry*
+    protopirate_protocol_loader_get_registry(ProtoPirateProtocolLoader* instance);
@@ -0,0 +1,70 @@
+// helpers/protopirate_scan_plan.c
+#include "protopirate_scan_plan.h"
+
+#define TAG "ProtoPirateScanPlan"
+
+// One wide AM preset and both FM deviations cover every registered protocol
+static const char* const scan_presets[] = {
+    "AM650",
+    "FM238",
+    "FM476",
+};
+
+static uint8_t protopirate_scan_plan_add_preset(
+    ProtoPirateScanStep* step,
+    uint8_t step_count,
+    SubGhzSetting* setting,
+    uint8_t preset_index) {
+    size_t frequency_count = subghz_setting_get_hopper_frequency_count(setting);
+    for(size_t i = 0; i < frequency_count && step_count < PROTOPIRATE_HOPPER_CHANNEL_MAX; i++) {
+        step[step_count].frequency = subghz_setting_get_hopper_frequency(setting, i);
+        step[step_count].preset_index = preset_index;
+        step_count++;
+    }
+    return step_count;
+}
+
+bool protopirate_scan_plan_build(
+    ProtoPirateScanPlan* plan,
+    SubGhzSetting* setting,
+    bool scan_modulation) {
+    furi_assert(plan);
+    furi_assert(setting);
+
+    ProtoPirateScanStep step[PROTOPIRATE_HOPPER_CHANNEL_MAX];
+    uint8_t step_count = 0;
+
+    if(scan_modulation) {
+        size_t preset_count = subghz_setting_get_preset_count(setting);
+        for(size_t p = 0; p < COUNT_OF(scan_presets); p++) {
+            for(size_t i = 0; i < preset_count; i++) {
+                if(!strcmp(subghz_setting_get_preset_name(setting, i), scan_presets[p])) {
+                    step_count =
+                        protopirate_scan_plan_add_preset(step, step_count, setting, (uint8_t)i);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Frequency-only hopping, or none of the scan presets is in the setting
+    if(step_count == 0) {
+        step_count = protopirate_scan_plan_add_preset(
+            step, step_count, setting, PROTOPIRATE_SCAN_PRESET_KEEP);
+    }
+
+    bool changed = (step_count != plan->step_count) ||
+                   memcmp(step, plan->step, step_count * sizeof(ProtoPirateScanStep));
+    if(changed) {
+        memcpy(plan->step, step, step_count * sizeof(ProtoPirateScanStep));
+        plan->step_count = step_count;
+        FURI_LOG_I(TAG, "Scan plan: %u steps", step_count);
+    }
+    return changed;
+}
+
+const ProtoPirateScanStep* protopirate_scan_plan_get_step(ProtoPirateScanPlan* plan, uint8_t idx) {
+    furi_assert(plan);
+    furi_assert(idx < plan->step_count);
+    return &plan->step[idx];
+}
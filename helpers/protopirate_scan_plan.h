@@ -0,0 +1,37 @@
+// helpers/protopirate_scan_plan.h
+#pragma once
+
+#include <furi.h>
+#include <lib/subghz/subghz_setting.h>
+
+#include "protopirate_hopper_stats.h"
+
+/** Step keeps whatever preset the radio is running */
+#define PROTOPIRATE_SCAN_PRESET_KEEP 0xFF
+
+typedef struct {
+    uint32_t frequency;
+    uint8_t preset_index;
+} ProtoPirateScanStep;
+
+/**
+ * Ordered (frequency, preset) pairs the hopper cycles through.
+ * Steps are grouped by preset so the radio reloads its preset once per group.
+ */
+typedef struct {
+    ProtoPirateScanStep step[PROTOPIRATE_HOPPER_CHANNEL_MAX];
+    uint8_t step_count;
+} ProtoPirateScanPlan;
+
+/**
+ * Rebuild the plan from the hopper frequencies in the setting.
+ * @param scan_modulation visit every frequency once per AM/FM scan preset,
+ *                        otherwise stay on the current preset
+ * @return true when the plan differs from the previous one
+ */
+bool protopirate_scan_plan_build(
+    ProtoPirateScanPlan* plan,
+    SubGhzSetting* setting,
+    bool scan_modulation);
+
+const ProtoPirateScanStep* protopirate_scan_plan_get_step(ProtoPirateScanPlan* plan, uint8_t idx);
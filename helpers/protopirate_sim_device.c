@@ -0,0 +1,478 @@
+// helpers/protopirate_sim_device.c
+#include "protopirate_sim_device.h"
+
+#include <furi_hal.h>
+#include <furi_hal_cortex.h>
+#include <flipper_format/flipper_format.h>
+
+#define TAG "ProtoPirateSimDevice"
+
+#define SIM_SCRIPT_FILETYPE   "ProtoPirate Sim"
+#define SIM_SCRIPT_VERSION    1
+#define SIM_RAW_CHUNK         512
+#define SIM_RSSI_MAX          16
+#define SIM_RSSI_NOISE        -100.0f
+#define SIM_RSSI_BURST        -45.0f
+#define SIM_BURST_GAP_US      20000
+#define SIM_THREAD_STACK_SIZE 2048
+// Pulses delivered more than this after their end count as late
+#define SIM_LATE_US 1000
+// Further behind than this the replay drops the lag instead of rushing to catch up
+#define SIM_RESYNC_US 100000
+// The cycle counter wraps after a minute, longer pulses are cut to this
+#define SIM_WAIT_MAX_US 30000000
+// CC1101 modem config 2, MOD_FORMAT in bits 6:4, 3 is ASK/OOK
+#define SIM_CC1101_MDMCFG2       0x12
+#define SIM_CC1101_MOD_FORMAT_AM 3
+#define SIM_PRESET_PAIRS_MAX     64
+
+typedef enum {
+    SimStateIdle,
+    SimStateRx,
+    SimStateSleep,
+} SimState;
+
+typedef enum {
+    SimThreadFlagStop = (1 << 0),
+} SimThreadFlag;
+
+typedef enum {
+    // Unknown, matches every preset
+    SimModulationAny,
+    SimModulationAm,
+    SimModulationFm,
+} SimModulation;
+
+typedef struct {
+    // Cycle count at which the current pulse ends
+    uint32_t deadline;
+    uint32_t late_count;
+    uint32_t late_max_us;
+} SimClock;
+
+typedef struct {
+    FuriString* capture_path;
+    uint32_t capture_frequency;
+    SimModulation capture_modulation;
+    uint32_t loop_gap_us;
+    float burst_rssi;
+    uint32_t rssi_frequency[SIM_RSSI_MAX];
+    float rssi_value[SIM_RSSI_MAX];
+    uint8_t rssi_count;
+
+    volatile SimState state;
+    volatile uint32_t frequency;
+    volatile SimModulation modulation;
+    volatile bool burst_active;
+
+    FuriHalSubGhzCaptureCallback rx_callback;
+    void* rx_context;
+    FuriThread* thread;
+} ProtoPirateSimDevice;
+
+static ProtoPirateSimDevice* sim = NULL;
+
+// Modulation a CC1101 register list sets, pairs of address and value up to 0, 0
+static SimModulation protopirate_sim_get_modulation(const uint8_t* data, size_t size) {
+    for(size_t i = 0; i + 1 < size && data[i]; i += 2) {
+        if(data[i] == SIM_CC1101_MDMCFG2) {
+            return ((data[i + 1] >> 4) & 0x7) == SIM_CC1101_MOD_FORMAT_AM ? SimModulationAm :
+                                                                            SimModulationFm;
+        }
+    }
+    return SimModulationAny;
+}
+
+// Built-in presets by name, the Sub-GHz app only ships OOK as AM
+static SimModulation protopirate_sim_get_capture_modulation(FlipperFormat* ff) {
+    FuriString* preset = furi_string_alloc();
+    SimModulation modulation = SimModulationAny;
+    uint32_t size = 0;
+
+    flipper_format_rewind(ff);
+    if(!flipper_format_read_string(ff, "Preset", preset)) {
+        // Older captures, replay on every preset
+    } else if(furi_string_cmp_str(preset, "FuriHalSubGhzPresetCustom")) {
+        modulation = furi_string_search_str(preset, "Ook") != FURI_STRING_FAILURE ?
+                         SimModulationAm :
+                         SimModulationFm;
+    } else if(
+        flipper_format_get_value_count(ff, "Custom_preset_data", &size) && size &&
+        size <= SIM_PRESET_PAIRS_MAX * 2) {
+        uint8_t* data = malloc(size);
+        if(flipper_format_read_hex(ff, "Custom_preset_data", data, size)) {
+            modulation = protopirate_sim_get_modulation(data, size);
+        }
+        free(data);
+    }
+
+    furi_string_free(preset);
+    return modulation;
+}
+
+static bool protopirate_sim_load_capture(Storage* storage) {
+    FlipperFormat* ff = flipper_format_file_alloc(storage);
+    bool result = false;
+
+    if(flipper_format_file_open_existing(ff, furi_string_get_cstr(sim->capture_path)) &&
+       flipper_format_read_uint32(ff, "Frequency", &sim->capture_frequency, 1)) {
+        sim->capture_modulation = protopirate_sim_get_capture_modulation(ff);
+        result = true;
+    } else {
+        FURI_LOG_E(TAG, "Capture %s unusable", furi_string_get_cstr(sim->capture_path));
+    }
+
+    flipper_format_free(ff);
+    return result;
+}
+
+static bool protopirate_sim_load_script(const char* script_path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_file_alloc(storage);
+    FuriString* temp_str = furi_string_alloc();
+    uint32_t version = 0;
+    bool result = false;
+
+    do {
+        if(!flipper_format_file_open_existing(ff, script_path)) break;
+        if(!flipper_format_read_header(ff, temp_str, &version)) break;
+        if(furi_string_cmp_str(temp_str, SIM_SCRIPT_FILETYPE) ||
+           version != SIM_SCRIPT_VERSION) {
+            FURI_LOG_E(TAG, "Wrong script type or version");
+            break;
+        }
+        if(!flipper_format_read_string(ff, "Capture", sim->capture_path)) {
+            FURI_LOG_E(TAG, "Missing Capture");
+            break;
+        }
+
+        // Everything below is optional
+        flipper_format_rewind(ff);
+        if(!flipper_format_read_uint32(ff, "Loop_gap", &sim->loop_gap_us, 1)) {
+            sim->loop_gap_us = 0;
+        }
+        flipper_format_rewind(ff);
+        if(!flipper_format_read_float(ff, "Burst_rssi", &sim->burst_rssi, 1)) {
+            sim->burst_rssi = SIM_RSSI_BURST;
+        }
+
+        uint32_t count = 0;
+        flipper_format_rewind(ff);
+        if(flipper_format_get_value_count(ff, "Rssi_frequency", &count) && count > 0) {
+            count = MIN(count, (uint32_t)SIM_RSSI_MAX);
+            flipper_format_rewind(ff);
+            bool ok = flipper_format_read_uint32(ff, "Rssi_frequency", sim->rssi_frequency, count);
+            flipper_format_rewind(ff);
+            ok = ok && flipper_format_read_float(ff, "Rssi_value", sim->rssi_value, count);
+            sim->rssi_count = ok ? count : 0;
+        }
+
+        result = protopirate_sim_load_capture(storage);
+    } while(false);
+
+    furi_string_free(temp_str);
+    flipper_format_free(ff);
+    furi_record_close(RECORD_STORAGE);
+    return result;
+}
+
+// Sleeps until the end of the next pulse. The deadline advances by the exact
+// pulse length, so scheduling jitter never accumulates. A pulse ending within
+// a millisecond goes out right away instead of spinning for it: the worker
+// buffers pulses and only looks at their durations, so a burst decodes the
+// same when it arrives in a few batches. Lateness is measured, not hidden.
+static bool protopirate_sim_wait(SimClock* clock, uint32_t duration_us) {
+    uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+    clock->deadline += MIN(duration_us, (uint32_t)SIM_WAIT_MAX_US) * cycles_per_us;
+
+    int32_t ahead_us = (int32_t)(clock->deadline - DWT->CYCCNT) / (int32_t)cycles_per_us;
+    if(ahead_us >= 1000) {
+        uint32_t flags = furi_thread_flags_wait(
+            SimThreadFlagStop, FuriFlagWaitAny, furi_ms_to_ticks(ahead_us / 1000));
+        if(!(flags & FuriFlagError) && (flags & SimThreadFlagStop)) return false;
+    } else if(ahead_us < -SIM_LATE_US) {
+        clock->late_count++;
+        clock->late_max_us = MAX(clock->late_max_us, (uint32_t)-ahead_us);
+        if(ahead_us < -SIM_RESYNC_US) clock->deadline = DWT->CYCCNT;
+    }
+
+    return !(furi_thread_flags_get() & SimThreadFlagStop);
+}
+
+// Only while listening where and how the capture was recorded
+static bool protopirate_sim_is_tuned(void) {
+    return (sim->capture_frequency == 0 || sim->frequency == sim->capture_frequency) &&
+           (sim->capture_modulation == SimModulationAny || sim->modulation == SimModulationAny ||
+            sim->modulation == sim->capture_modulation);
+}
+
+static void protopirate_sim_emit(bool level, uint32_t duration) {
+    sim->burst_active = duration < SIM_BURST_GAP_US;
+    if(sim->state == SimStateRx && sim->rx_callback && protopirate_sim_is_tuned()) {
+        sim->rx_callback(level, duration, sim->rx_context);
+    }
+}
+
+static int32_t protopirate_sim_thread(void* context) {
+    UNUSED(context);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* ff = flipper_format_file_alloc(storage);
+    int32_t* chunk = malloc(sizeof(int32_t) * SIM_RAW_CHUNK);
+    SimClock clock = {.deadline = DWT->CYCCNT};
+    bool running = true;
+
+    while(running) {
+        if(!flipper_format_file_open_existing(ff, furi_string_get_cstr(sim->capture_path))) {
+            FURI_LOG_E(TAG, "Failed to open capture");
+            break;
+        }
+
+        uint32_t count = 0;
+        while(running && flipper_format_get_value_count(ff, "RAW_Data", &count)) {
+            count = MIN(count, (uint32_t)SIM_RAW_CHUNK);
+            if(!flipper_format_read_int32(ff, "RAW_Data", chunk, count)) break;
+
+            for(uint32_t i = 0; running && i < count; i++) {
+                bool level = chunk[i] > 0;
+                uint32_t duration = level ? (uint32_t)chunk[i] : (uint32_t)-chunk[i];
+                running = protopirate_sim_wait(&clock, duration);
+                if(running) protopirate_sim_emit(level, duration);
+            }
+        }
+        flipper_format_file_close(ff);
+
+        sim->burst_active = false;
+        if(sim->loop_gap_us == 0) break;
+        running = running && protopirate_sim_wait(&clock, sim->loop_gap_us);
+    }
+
+    if(clock.late_count) {
+        FURI_LOG_W(
+            TAG, "%lu pulses late, up to %lu us", clock.late_count, clock.late_max_us);
+    }
+
+    free(chunk);
+    flipper_format_free(ff);
+    furi_record_close(RECORD_STORAGE);
+    return 0;
+}
+
+static bool protopirate_sim_begin(void) {
+    return sim != NULL;
+}
+
+static void protopirate_sim_end(void) {
+    if(!sim) return;
+    furi_assert(!sim->thread);
+    furi_string_free(sim->capture_path);
+    free(sim);
+    sim = NULL;
+}
+
+static bool protopirate_sim_is_connect(void) {
+    return sim != NULL;
+}
+
+static void protopirate_sim_reset(void) {
+    sim->state = SimStateIdle;
+}
+
+static void protopirate_sim_sleep(void) {
+    sim->state = SimStateSleep;
+}
+
+static void protopirate_sim_idle(void) {
+    sim->state = SimStateIdle;
+}
+
+static void protopirate_sim_load_preset(FuriHalSubGhzPreset preset, uint8_t* preset_data) {
+    switch(preset) {
+    case FuriHalSubGhzPresetOok270Async:
+    case FuriHalSubGhzPresetOok650Async:
+        sim->modulation = SimModulationAm;
+        break;
+    case FuriHalSubGhzPresetCustom:
+        sim->modulation = preset_data ? protopirate_sim_get_modulation(
+                                            preset_data, SIM_PRESET_PAIRS_MAX * 2) :
+                                        SimModulationAny;
+        break;
+    case FuriHalSubGhzPresetIdle:
+        sim->modulation = SimModulationAny;
+        break;
+    default:
+        sim->modulation = SimModulationFm;
+        break;
+    }
+}
+
+static uint32_t protopirate_sim_set_frequency(uint32_t frequency) {
+    sim->frequency = frequency;
+    return frequency;
+}
+
+static bool protopirate_sim_is_frequency_valid(uint32_t frequency) {
+    return (frequency >= 300000000 && frequency <= 348000000) ||
+           (frequency >= 387000000 && frequency <= 464000000) ||
+           (frequency >= 779000000 && frequency <= 928000000);
+}
+
+static void protopirate_sim_set_async_mirror_pin(const GpioPin* gpio) {
+    UNUSED(gpio);
+}
+
+static const GpioPin* protopirate_sim_get_data_gpio(void) {
+    return NULL;
+}
+
+static bool protopirate_sim_set_tx(void) {
+    // The simulator has no transmitter
+    return false;
+}
+
+static void protopirate_sim_flush_tx(void) {
+}
+
+static bool protopirate_sim_start_async_tx(void* callback, void* context) {
+    UNUSED(callback);
+    UNUSED(context);
+    return false;
+}
+
+static bool protopirate_sim_is_async_complete_tx(void) {
+    return true;
+}
+
+static void protopirate_sim_stop_async_tx(void) {
+}
+
+static void protopirate_sim_set_rx(void) {
+    sim->state = SimStateRx;
+}
+
+static void protopirate_sim_flush_rx(void) {
+}
+
+static void protopirate_sim_start_async_rx(void* callback, void* context) {
+    furi_assert(!sim->thread);
+    sim->rx_callback = callback;
+    sim->rx_context = context;
+    sim->thread = furi_thread_alloc_ex(
+        "ProtoPirateSim", SIM_THREAD_STACK_SIZE, protopirate_sim_thread, NULL);
+    // Sleeps between pulses, no need to preempt the worker it feeds
+    furi_thread_set_priority(sim->thread, FuriThreadPriorityHigh);
+    furi_thread_start(sim->thread);
+}
+
+static void protopirate_sim_stop_async_rx(void) {
+    if(!sim->thread) return;
+    furi_thread_flags_set(furi_thread_get_id(sim->thread), SimThreadFlagStop);
+    furi_thread_join(sim->thread);
+    furi_thread_free(sim->thread);
+    sim->thread = NULL;
+    sim->rx_callback = NULL;
+    sim->rx_context = NULL;
+    sim->burst_active = false;
+}
+
+static float protopirate_sim_get_rssi(void) {
+    if(sim->burst_active && protopirate_sim_is_tuned()) {
+        return sim->burst_rssi;
+    }
+    for(uint8_t i = 0; i < sim->rssi_count; i++) {
+        if(sim->rssi_frequency[i] == sim->frequency) return sim->rssi_value[i];
+    }
+    return SIM_RSSI_NOISE;
+}
+
+static uint8_t protopirate_sim_get_lqi(void) {
+    return 0;
+}
+
+static bool protopirate_sim_rx_pipe_not_empty(void) {
+    return false;
+}
+
+static bool protopirate_sim_is_rx_data_crc_valid(void) {
+    return false;
+}
+
+static void protopirate_sim_read_packet(uint8_t* data, uint8_t* size) {
+    UNUSED(data);
+    *size = 0;
+}
+
+static void protopirate_sim_write_packet(const uint8_t* data, uint8_t size) {
+    UNUSED(data);
+    UNUSED(size);
+}
+
+static const SubGhzDeviceInterconnect protopirate_sim_interconnect = {
+    .begin = protopirate_sim_begin,
+    .end = protopirate_sim_end,
+    .is_connect = protopirate_sim_is_connect,
+    .reset = protopirate_sim_reset,
+    .sleep = protopirate_sim_sleep,
+    .idle = protopirate_sim_idle,
+    .load_preset = protopirate_sim_load_preset,
+    .set_frequency = protopirate_sim_set_frequency,
+    .is_frequency_valid = protopirate_sim_is_frequency_valid,
+    .set_async_mirror_pin = protopirate_sim_set_async_mirror_pin,
+    .get_data_gpio = protopirate_sim_get_data_gpio,
+    .set_tx = protopirate_sim_set_tx,
+    .flush_tx = protopirate_sim_flush_tx,
+    .start_async_tx = protopirate_sim_start_async_tx,
+    .is_async_complete_tx = protopirate_sim_is_async_complete_tx,
+    .stop_async_tx = protopirate_sim_stop_async_tx,
+    .set_rx = protopirate_sim_set_rx,
+    .flush_rx = protopirate_sim_flush_rx,
+    .start_async_rx = protopirate_sim_start_async_rx,
+    .stop_async_rx = protopirate_sim_stop_async_rx,
+    .get_rssi = protopirate_sim_get_rssi,
+    .get_lqi = protopirate_sim_get_lqi,
+    .rx_pipe_not_empty = protopirate_sim_rx_pipe_not_empty,
+    .is_rx_data_crc_valid = protopirate_sim_is_rx_data_crc_valid,
+    .read_packet = protopirate_sim_read_packet,
+    .write_packet = protopirate_sim_write_packet,
+};
+
+static const SubGhzDevice protopirate_sim_device = {
+    .name = PROTOPIRATE_SIM_DEVICE_NAME,
+    .interconnect = &protopirate_sim_interconnect,
+};
+
+bool protopirate_sim_device_is_available(void) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = storage_file_exists(storage, PROTOPIRATE_SIM_SCRIPT_PATH);
+    furi_record_close(RECORD_STORAGE);
+    return result;
+}
+
+const SubGhzDevice* protopirate_sim_device_load(const char* script_path) {
+    furi_assert(script_path);
+    furi_check(sim == NULL);
+
+    sim = malloc(sizeof(ProtoPirateSimDevice));
+    memset(sim, 0, sizeof(ProtoPirateSimDevice));
+    sim->capture_path = furi_string_alloc();
+    sim->state = SimStateIdle;
+
+    if(!protopirate_sim_load_script(script_path)) {
+        FURI_LOG_E(TAG, "Failed to load sim script %s", script_path);
+        protopirate_sim_end();
+        return NULL;
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "Replaying %s on %lu Hz %s",
+        furi_string_get_cstr(sim->capture_path),
+        sim->capture_frequency,
+        sim->capture_modulation == SimModulationAm ? "AM" :
+        sim->capture_modulation == SimModulationFm ? "FM" :
+                                                     "any");
+    return &protopirate_sim_device;
+}
+
+bool protopirate_sim_device_is_sim(const SubGhzDevice* radio_device) {
+    return radio_device == &protopirate_sim_device;
+}
@@ -0,0 +1,36 @@
+// helpers/protopirate_sim_device.h
+#pragma once
+
+#include <furi.h>
+#include <lib/subghz/devices/devices.h>
+
+#include "protopirate_storage.h"
+
+#define PROTOPIRATE_SIM_DEVICE_NAME "protopirate_sim"
+#define PROTOPIRATE_SIM_SCRIPT_PATH PROTOPIRATE_APP_FOLDER "/sim.txt"
+
+/**
+ * Simulated SubGhz radio.
+ *
+ * Replays the RAW capture named in a sim script as async RX pulses with
+ * their recorded timing, to within a millisecond: pulses due sooner go out
+ * in a batch and late ones are counted. Pulses only reach the worker while
+ * the device is in RX, tuned to the capture frequency and on a preset of
+ * the capture's modulation (AM or FM), RSSI comes from the script.
+ *
+ * Script format (FlipperFormat):
+ *   Filetype: ProtoPirate Sim
+ *   Version: 1
+ *   Capture: /ext/subghz/protopirate/sim/kia_v0.sub
+ *   Loop_gap: 500000          (us between replays, 0 plays once)
+ *   Burst_rssi: -45           (reported while a burst is on air)
+ *   Rssi_frequency: 315000000 433920000
+ *   Rssi_value: -98 -92       (background level per frequency)
+ */
+
+bool protopirate_sim_device_is_available(void);
+
+/** Load the script and return the device, NULL if the script is unusable */
+const SubGhzDevice* protopirate_sim_device_load(const char* script_path);
+
+bool protopirate_sim_device_is_sim(const SubGhzDevice* radio_device);
@@ -8,6 +8,10 @@
 #define PROTOPIRATE_APP_FOLDER EXT_PATH("subghz/protopirate")
 #define PROTOPIRATE_APP_EXTENSION ".sub"
 #define PROTOPIRATE_APP_FILE_VERSION 1
+// Overwritten on every dump, not a capture so the saved list skips it
+#define PROTOPIRATE_DECODER_STATS_PATH PROTOPIRATE_APP_FOLDER "/decoder_stats.txt"
+#define PROTOPIRATE_LATENCY_PATH       PROTOPIRATE_APP_FOLDER "/latency.txt"
+#define PROTOPIRATE_TRACE_PATH         PROTOPIRATE_APP_FOLDER "/trace.bin"
 
 bool protopirate_storage_init();
 bool protopirate_storage_save_capture(
@@ -0,0 +1,88 @@
+// helpers/protopirate_trace.c
+#include "protopirate_trace.h"
+
+#include <storage/storage.h>
+
+#define TAG "ProtoPirateTrace"
+
+struct ProtoPirateTrace {
+    ProtoPirateTraceRing ring;
+};
+
+ProtoPirateTrace* protopirate_trace_alloc(void) {
+    ProtoPirateTrace* instance = malloc(sizeof(ProtoPirateTrace));
+    protopirate_trace_reset(instance);
+    furi_record_create(PROTOPIRATE_TRACE_RECORD, &instance->ring);
+    return instance;
+}
+
+void protopirate_trace_free(ProtoPirateTrace* instance) {
+    furi_assert(instance);
+    // Fails while a decoder still holds the ring
+    furi_check(furi_record_destroy(PROTOPIRATE_TRACE_RECORD));
+    free(instance);
+}
+
+ProtoPirateTraceRing* protopirate_trace_get_ring(ProtoPirateTrace* instance) {
+    furi_assert(instance);
+    return &instance->ring;
+}
+
+void protopirate_trace_reset(ProtoPirateTrace* instance) {
+    furi_assert(instance);
+    // A writer racing the reset leaves one stale record, the seq check drops it
+    memset(instance->ring.entry, 0, sizeof(instance->ring.entry));
+    __atomic_store_n(&instance->ring.head, 0, __ATOMIC_RELEASE);
+}
+
+uint32_t protopirate_trace_get_count(ProtoPirateTrace* instance) {
+    furi_assert(instance);
+    return __atomic_load_n(&instance->ring.head, __ATOMIC_ACQUIRE);
+}
+
+bool protopirate_trace_save(ProtoPirateTrace* instance, const char* path) {
+    furi_assert(instance);
+    furi_assert(path);
+
+    ProtoPirateTraceRing* ring = &instance->ring;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t first = head > PROTOPIRATE_TRACE_SIZE ? head - PROTOPIRATE_TRACE_SIZE : 0;
+
+    // Snapshot first, writers keep going while the SD card is slow
+    ProtoPirateTraceEntry* entry = malloc(sizeof(ring->entry));
+    uint32_t count = 0;
+    for(uint32_t slot = first; slot < head; slot++) {
+        const ProtoPirateTraceEntry* source = &ring->entry[slot & (PROTOPIRATE_TRACE_SIZE - 1)];
+        entry[count] = *source;
+        // Overwritten or half written while copying
+        if(__atomic_load_n(&source->seq, __ATOMIC_ACQUIRE) != slot + 1 ||
+           entry[count].seq != slot + 1) {
+            continue;
+        }
+        count++;
+    }
+
+    const uint32_t header[] = {
+        PROTOPIRATE_TRACE_MAGIC,
+        PROTOPIRATE_TRACE_VERSION,
+        sizeof(ProtoPirateTraceEntry),
+        furi_hal_cortex_instructions_per_microsecond(),
+        count,
+    };
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool result = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                  storage_file_write(file, header, sizeof(header)) == sizeof(header) &&
+                  storage_file_write(file, entry, sizeof(ProtoPirateTraceEntry) * count) ==
+                      sizeof(ProtoPirateTraceEntry) * count;
+    if(!result) {
+        FURI_LOG_E(TAG, "Failed to write %s", path);
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    free(entry);
+    return result;
+}
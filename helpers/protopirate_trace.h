@@ -0,0 +1,35 @@
+// helpers/protopirate_trace.h
+#pragma once
+
+#include <furi.h>
+#include "../protocols/protocol_trace.h"
+
+// "PPTR" little endian, first word of a dump
+#define PROTOPIRATE_TRACE_MAGIC   0x52545050UL
+#define PROTOPIRATE_TRACE_VERSION 1
+
+/**
+ * Owner of the trace ring, see protocols/protocol_trace.h.
+ *
+ * Publishes the ring as PROTOPIRATE_TRACE_RECORD, so it must be allocated
+ * before any decoder and freed after the last one.
+ */
+typedef struct ProtoPirateTrace ProtoPirateTrace;
+
+ProtoPirateTrace* protopirate_trace_alloc(void);
+void protopirate_trace_free(ProtoPirateTrace* instance);
+
+/** The ring trace points write to */
+ProtoPirateTraceRing* protopirate_trace_get_ring(ProtoPirateTrace* instance);
+
+void protopirate_trace_reset(ProtoPirateTrace* instance);
+
+/** Records written since the last reset, the ring keeps the last PROTOPIRATE_TRACE_SIZE */
+uint32_t protopirate_trace_get_count(ProtoPirateTrace* instance);
+
+/**
+ * Dump the ring oldest first: magic, version, record size, cycles per us
+ * and record count as uint32, then the ProtoPirateTraceEntry records.
+ * Decode with tools/protopirate_trace.py.
+ */
+bool protopirate_trace_save(ProtoPirateTrace* instance, const char* path);
@@ -12,6 +12,7 @@ typedef enum
     ProtoPirateViewReceiver,
     ProtoPirateViewReceiverInfo,
     ProtoPirateViewAbout,
+    ProtoPirateViewWaterfall,
 } ProtoPirateView;
 
 typedef enum
@@ -21,6 +22,9 @@ typedef enum
     ProtoPirateCustomEventViewReceiverConfig,
     ProtoPirateCustomEventViewReceiverBack,
     ProtoPirateCustomEventViewReceiverUnlock,
+    ProtoPirateCustomEventViewReceiverWaterfall,
+    ProtoPirateCustomEventViewWaterfallBack,
+    ProtoPirateCustomEventViewReceiverRecord,
     // Custom events for scenes
     ProtoPirateCustomEventSceneReceiverUpdate,
     ProtoPirateCustomEventSceneSettingLock,
@@ -32,6 +36,9 @@ typedef enum
     ProtoPirateCustomEventEmulateTransmit,
     ProtoPirateCustomEventEmulateStop,
     ProtoPirateCustomEventEmulateExit,
+    // Decoder stats
+    ProtoPirateCustomEventDecoderStatsSave,
+    ProtoPirateCustomEventDecoderStatsReset,
 } ProtoPirateCustomEvent;
 
 typedef enum
@@ -0,0 +1,85 @@
+// helpers/protopirate_waterfall.c
+#include "protopirate_waterfall.h"
+
+struct ProtoPirateWaterfall {
+    int8_t column[PROTOPIRATE_WATERFALL_COLUMNS][PROTOPIRATE_WATERFALL_ROWS_MAX];
+    int8_t open[PROTOPIRATE_WATERFALL_ROWS_MAX];
+    uint32_t sequence;
+    uint8_t row_count;
+    uint8_t epoch;
+};
+
+static void protopirate_waterfall_clear_open(ProtoPirateWaterfall* instance) {
+    memset(instance->open, PROTOPIRATE_WATERFALL_EMPTY, sizeof(instance->open));
+}
+
+ProtoPirateWaterfall* protopirate_waterfall_alloc(void) {
+    ProtoPirateWaterfall* instance = malloc(sizeof(ProtoPirateWaterfall));
+    instance->epoch = 0;
+    protopirate_waterfall_reset(instance, 1);
+    return instance;
+}
+
+void protopirate_waterfall_free(ProtoPirateWaterfall* instance) {
+    furi_assert(instance);
+    free(instance);
+}
+
+void protopirate_waterfall_reset(ProtoPirateWaterfall* instance, uint8_t row_count) {
+    furi_assert(instance);
+    instance->row_count = CLAMP(row_count, PROTOPIRATE_WATERFALL_ROWS_MAX, 1);
+    instance->sequence = 0;
+    instance->epoch++;
+    protopirate_waterfall_clear_open(instance);
+}
+
+void protopirate_waterfall_set_row_count(ProtoPirateWaterfall* instance, uint8_t row_count) {
+    furi_assert(instance);
+    if(CLAMP(row_count, PROTOPIRATE_WATERFALL_ROWS_MAX, 1) != instance->row_count) {
+        protopirate_waterfall_reset(instance, row_count);
+    }
+}
+
+uint8_t protopirate_waterfall_get_row_count(ProtoPirateWaterfall* instance) {
+    furi_assert(instance);
+    return instance->row_count;
+}
+
+uint8_t protopirate_waterfall_get_epoch(ProtoPirateWaterfall* instance) {
+    furi_assert(instance);
+    return instance->epoch;
+}
+
+void protopirate_waterfall_add_rssi(ProtoPirateWaterfall* instance, uint8_t row, float rssi) {
+    furi_assert(instance);
+    if(row >= instance->row_count) return;
+
+    int8_t value = (int8_t)CLAMP(rssi, 0.0f, -127.0f);
+    if(value > instance->open[row]) {
+        instance->open[row] = value;
+    }
+}
+
+void protopirate_waterfall_commit(ProtoPirateWaterfall* instance) {
+    furi_assert(instance);
+    memcpy(
+        instance->column[instance->sequence % PROTOPIRATE_WATERFALL_COLUMNS],
+        instance->open,
+        instance->row_count);
+    instance->sequence++;
+    protopirate_waterfall_clear_open(instance);
+}
+
+uint32_t protopirate_waterfall_get_sequence(ProtoPirateWaterfall* instance) {
+    furi_assert(instance);
+    return instance->sequence;
+}
+
+const int8_t* protopirate_waterfall_get_column(ProtoPirateWaterfall* instance, uint32_t sequence) {
+    furi_assert(instance);
+    if(sequence >= instance->sequence ||
+       instance->sequence - sequence > PROTOPIRATE_WATERFALL_COLUMNS) {
+        return NULL;
+    }
+    return instance->column[sequence % PROTOPIRATE_WATERFALL_COLUMNS];
+}
@@ -0,0 +1,46 @@
+// helpers/protopirate_waterfall.h
+#pragma once
+
+#include <furi.h>
+
+#include "protopirate_hopper_stats.h"
+
+#define PROTOPIRATE_WATERFALL_COLUMNS  64
+#define PROTOPIRATE_WATERFALL_ROWS_MAX PROTOPIRATE_HOPPER_CHANNEL_MAX
+/** Cell that wasn't sampled during its column */
+#define PROTOPIRATE_WATERFALL_EMPTY    INT8_MIN
+
+/**
+ * RSSI history per hopper step.
+ *
+ * Samples are max-accumulated into an open column. Committing the column
+ * pushes it into a fixed ring, readers follow the ring by sequence number
+ * and pick up only the columns they haven't seen yet.
+ */
+typedef struct ProtoPirateWaterfall ProtoPirateWaterfall;
+
+ProtoPirateWaterfall* protopirate_waterfall_alloc(void);
+void protopirate_waterfall_free(ProtoPirateWaterfall* instance);
+
+/** Drop all history and switch to a new row layout */
+void protopirate_waterfall_reset(ProtoPirateWaterfall* instance, uint8_t row_count);
+
+/** Same as reset, but keeps the history when the layout doesn't change */
+void protopirate_waterfall_set_row_count(ProtoPirateWaterfall* instance, uint8_t row_count);
+
+uint8_t protopirate_waterfall_get_row_count(ProtoPirateWaterfall* instance);
+
+/** Bumped by every reset, readers restart from scratch when it moves */
+uint8_t protopirate_waterfall_get_epoch(ProtoPirateWaterfall* instance);
+
+void protopirate_waterfall_add_rssi(ProtoPirateWaterfall* instance, uint8_t row, float rssi);
+void protopirate_waterfall_commit(ProtoPirateWaterfall* instance);
+
+/** Sequence number of the next column to be committed */
+uint32_t protopirate_waterfall_get_sequence(ProtoPirateWaterfall* instance);
+
+/**
+ * Committed column by sequence number.
+ * @return row_count dBm values, NULL if the column already left the ring
+ */
+const int8_t* protopirate_waterfall_get_column(ProtoPirateWaterfall* instance, uint32_t sequence);
@@ -1,5 +1,6 @@
 // helpers/radio_device_loader.c
 #include "radio_device_loader.h"
+#include "protopirate_sim_device.h"
 
 #include <applications/drivers/subghz/cc1101_ext/cc1101_ext_interconnect.h>
 #include <lib/subghz/devices/cc1101_int/cc1101_int_interconnect.h>
@@ -41,7 +42,11 @@ const SubGhzDevice* radio_device_loader_set(
     SubGhzRadioDeviceType radio_device_type) {
     const SubGhzDevice* radio_device;
 
-    if(radio_device_type == SubGhzRadioDeviceTypeExternalCC1101 &&
+    if(radio_device_type == SubGhzRadioDeviceTypeSimulated) {
+        radio_device = protopirate_sim_device_load(PROTOPIRATE_SIM_SCRIPT_PATH);
+        if(radio_device) subghz_devices_begin(radio_device);
+    } else if(
+        radio_device_type == SubGhzRadioDeviceTypeExternalCC1101 &&
        radio_device_loader_is_connect_external(SUBGHZ_DEVICE_CC1101_EXT_NAME)) {
         radio_device_loader_power_on();
         radio_device = subghz_devices_get_by_name(SUBGHZ_DEVICE_CC1101_EXT_NAME);
@@ -63,6 +68,10 @@ bool radio_device_loader_is_external(const SubGhzDevice* radio_device) {
 
 void radio_device_loader_end(const SubGhzDevice* radio_device) {
     furi_assert(radio_device);
+    if(protopirate_sim_device_is_sim(radio_device)) {
+        subghz_devices_end(radio_device);
+        return;
+    }
     radio_device_loader_power_off();
     if(radio_device != subghz_devices_get_by_name(SUBGHZ_DEVICE_CC1101_INT_NAME)) {
         subghz_devices_end(radio_device);
@@ -7,6 +7,7 @@
 typedef enum {
     SubGhzRadioDeviceTypeInternal,
     SubGhzRadioDeviceTypeExternalCC1101,
+    SubGhzRadioDeviceTypeSimulated,
 } SubGhzRadioDeviceType;
 
 bool radio_device_loader_is_connect_external(const char* name);
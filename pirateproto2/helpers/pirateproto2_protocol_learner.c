@@ -0,0 +1,445 @@
+// helpers/pirateproto2_protocol_learner.c
+#include "pirateproto2_protocol_learner.h"
+
+#define TAG "PirateProto2ProtocolLearner"
+
+// Bursts shorter than this are noise
+#define BURST_MIN 24
+// A timing cluster needs 1/8 of the burst behind it
+#define CLUSTER_SHARE 3
+// Complementary high/low pairs, in percent, needed to call it PWM
+#define PWM_PAIRS_MIN 90
+
+const SubGhzProtocol pirateproto2_learned_protocol = {
+    .name = "Learned",
+    .type = SubGhzProtocolTypeStatic,
+    .flag = SubGhzProtocolFlag_433 | SubGhzProtocolFlag_AM | SubGhzProtocolFlag_Decodable,
+    .decoder = NULL,
+    .encoder = &subghz_protocol_pwm_encoder,
+};
+
+typedef enum
+{
+    LearnerSymbolShort,
+    LearnerSymbolLong,
+    LearnerSymbolOther,
+} LearnerSymbol;
+
+struct PirateProto2ProtocolLearner
+{
+    FuriMutex *mutex;
+    PirateProto2LearnerResult result;
+
+    // Worker side, only touched by feed
+    uint16_t burst[PIRATEPROTO2_LEARNER_BURST_MAX];
+    uint16_t burst_count;
+    bool in_burst;
+    bool overflow;
+
+    // Handed over to process, owned by it while pending is set
+    uint16_t pending[PIRATEPROTO2_LEARNER_BURST_MAX];
+    uint16_t pending_count;
+    bool pending_ready;
+};
+
+static LearnerSymbol
+pirateproto2_protocol_learner_classify(const SubGhzBlockConst *timing, uint32_t duration)
+{
+    if (DURATION_DIFF(duration, timing->te_short) < timing->te_delta)
+    {
+        return LearnerSymbolShort;
+    }
+    if (DURATION_DIFF(duration, timing->te_long) < timing->te_delta)
+    {
+        return LearnerSymbolLong;
+    }
+    return LearnerSymbolOther;
+}
+
+// Mean of the durations in [low, high], 0 if fewer than min_hits
+static uint32_t pirateproto2_protocol_learner_mean(
+    const uint16_t *burst,
+    uint16_t count,
+    uint32_t low,
+    uint32_t high,
+    uint16_t min_hits)
+{
+    uint32_t sum = 0;
+    uint16_t hits = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (burst[i] >= low && burst[i] <= high)
+        {
+            sum += burst[i];
+            hits++;
+        }
+    }
+    return (hits && hits >= min_hits) ? sum / hits : 0;
+}
+
+static bool pirateproto2_protocol_learner_get_timing(
+    const uint16_t *burst,
+    uint16_t count,
+    SubGhzBlockConst *timing)
+{
+    // te_short is the shortest duration with a real cluster behind it,
+    // lone glitches below it are skipped
+    uint16_t min_hits = MAX(count >> CLUSTER_SHARE, 2);
+    uint32_t floor = 0;
+    uint32_t te_short = 0;
+    for (uint8_t attempt = 0; attempt < 4 && !te_short; attempt++)
+    {
+        uint32_t min = UINT16_MAX;
+        for (uint16_t i = 0; i < count; i++)
+        {
+            if (burst[i] > floor && burst[i] < min)
+            {
+                min = burst[i];
+            }
+        }
+        if (min == UINT16_MAX)
+        {
+            return false;
+        }
+        te_short = pirateproto2_protocol_learner_mean(burst, count, min, min * 3 / 2, min_hits);
+        floor = min * 3 / 2;
+    }
+    if (!te_short)
+    {
+        return false;
+    }
+
+    uint32_t te_long = pirateproto2_protocol_learner_mean(
+        burst, count, te_short * 3 / 2 + 1, te_short * 4, 2);
+    if (!te_long)
+    {
+        return false;
+    }
+
+    timing->te_short = te_short;
+    timing->te_long = te_long;
+    // Half way to the other symbol at most, so both can never match
+    timing->te_delta = MAX(MIN(te_short / 2, (te_long - te_short) / 2), 1UL);
+    return true;
+}
+
+// Manchester data bits of the burst as the PWM engine would decode them
+static uint8_t pirateproto2_protocol_learner_count_manchester(
+    const uint16_t *burst,
+    uint16_t start,
+    uint16_t count,
+    const SubGhzBlockConst *timing,
+    uint16_t *half_bits)
+{
+    ManchesterState state;
+    manchester_advance(ManchesterStateMid1, ManchesterEventReset, &state, NULL);
+
+    uint16_t bits = 0;
+    *half_bits = 0;
+    for (uint16_t i = start; i < count; i++)
+    {
+        // Data always starts on a high, even offsets are highs
+        bool level = !((i - start) & 1);
+        ManchesterEvent event;
+        if (pirateproto2_protocol_learner_classify(timing, burst[i]) == LearnerSymbolShort)
+        {
+            event = level ? ManchesterEventShortLow : ManchesterEventShortHigh;
+            *half_bits += 1;
+        }
+        else
+        {
+            event = level ? ManchesterEventLongLow : ManchesterEventLongHigh;
+            *half_bits += 2;
+        }
+
+        bool data_bit;
+        if (manchester_advance(state, event, &state, &data_bit))
+        {
+            bits++;
+        }
+    }
+    return MIN(bits, (uint16_t)UINT8_MAX);
+}
+
+static bool pirateproto2_protocol_learner_analyse(
+    const uint16_t *burst,
+    uint16_t count,
+    PirateProto2LearnerResult *candidate)
+{
+    // The last entry is the gap that closed the burst
+    uint16_t end_gap = burst[count - 1];
+    count--;
+
+    PirateProto2PwmDescriptor *descriptor = &candidate->descriptor;
+    memset(descriptor, 0, sizeof(PirateProto2PwmDescriptor));
+    descriptor->protocol = &pirateproto2_learned_protocol;
+
+    SubGhzBlockConst *timing = &descriptor->timing;
+    if (!pirateproto2_protocol_learner_get_timing(burst, count, timing))
+    {
+        return false;
+    }
+
+    // Preamble: leading short high/low pairs
+    uint16_t preamble = 0;
+    while (preamble * 2 + 1 < count &&
+           pirateproto2_protocol_learner_classify(timing, burst[preamble * 2]) ==
+               LearnerSymbolShort &&
+           pirateproto2_protocol_learner_classify(timing, burst[preamble * 2 + 1]) ==
+               LearnerSymbolShort)
+    {
+        preamble++;
+    }
+
+    // Sync: the pair right after the preamble. Its high can't be short or
+    // the engine keeps counting preamble, and without a preamble it has to
+    // stand out from the data
+    uint16_t sync = preamble * 2;
+    if (sync + 1 >= count)
+    {
+        return false;
+    }
+    LearnerSymbol sync_high = pirateproto2_protocol_learner_classify(timing, burst[sync]);
+    LearnerSymbol sync_low = pirateproto2_protocol_learner_classify(timing, burst[sync + 1]);
+    if (sync_high == LearnerSymbolShort)
+    {
+        return false;
+    }
+    if (!preamble && sync_high != LearnerSymbolOther && sync_low != LearnerSymbolOther)
+    {
+        return false;
+    }
+
+    // Data runs from the sync to the last high, every duration must decode
+    uint16_t start = sync + 2;
+    if (count < start + 3)
+    {
+        return false;
+    }
+    uint16_t highs = 0;
+    uint16_t short_highs = 0;
+    uint16_t pairs = 0;
+    uint16_t complementary = 0;
+    for (uint16_t i = start; i < count; i++)
+    {
+        LearnerSymbol symbol = pirateproto2_protocol_learner_classify(timing, burst[i]);
+        if (symbol == LearnerSymbolOther)
+        {
+            return false;
+        }
+        if (!((i - start) & 1))
+        {
+            highs++;
+            if (symbol == LearnerSymbolShort)
+            {
+                short_highs++;
+            }
+        }
+        else
+        {
+            pairs++;
+            if (symbol != pirateproto2_protocol_learner_classify(timing, burst[i - 1]))
+            {
+                complementary++;
+            }
+        }
+    }
+
+    uint16_t bits;
+    if (short_highs == highs)
+    {
+        // Every high is a te_short, the last one is the stop pulse
+        descriptor->coding = PirateProto2PwmCodingPpm;
+        bits = highs - 1;
+        candidate->confidence = 100;
+    }
+    else if (complementary * 100 >= pairs * PWM_PAIRS_MIN)
+    {
+        // The last high is a bit too, its low is the gap
+        descriptor->coding = PirateProto2PwmCodingPwm;
+        bits = highs;
+        candidate->confidence = complementary * 100 / pairs;
+    }
+    else if (timing->te_long * 5 >= timing->te_short * 8 &&
+             timing->te_long * 5 <= timing->te_short * 12)
+    {
+        // te_long close to 2x te_short
+        descriptor->coding = PirateProto2PwmCodingManchester;
+        uint16_t half_bits;
+        bits = pirateproto2_protocol_learner_count_manchester(
+            burst, start, count, timing, &half_bits);
+        candidate->confidence = MIN(bits * 200 / half_bits, 100U);
+    }
+    else
+    {
+        return false;
+    }
+
+    if (!bits || bits > 64)
+    {
+        return false;
+    }
+
+    timing->min_count_bit_for_found = bits;
+    // Leave a margin for preamble pulses lost while the receiver settles
+    descriptor->preamble_count = preamble - preamble / 4;
+    descriptor->sync_high = burst[sync];
+    descriptor->sync_low = burst[sync + 1];
+    descriptor->gap = MIN((uint32_t)timing->te_long * 3, (uint32_t)end_gap);
+    return true;
+}
+
+static bool pirateproto2_protocol_learner_is_same(
+    const PirateProto2PwmDescriptor *a,
+    const PirateProto2PwmDescriptor *b)
+{
+    return a->coding == b->coding &&
+           a->timing.min_count_bit_for_found == b->timing.min_count_bit_for_found &&
+           (a->preamble_count > 0) == (b->preamble_count > 0) &&
+           DURATION_DIFF(a->timing.te_short, b->timing.te_short) < a->timing.te_delta &&
+           DURATION_DIFF(a->timing.te_long, b->timing.te_long) < a->timing.te_delta;
+}
+
+PirateProto2ProtocolLearner *pirateproto2_protocol_learner_alloc(void)
+{
+    PirateProto2ProtocolLearner *instance = malloc(sizeof(PirateProto2ProtocolLearner));
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    pirateproto2_protocol_learner_reset(instance);
+    return instance;
+}
+
+void pirateproto2_protocol_learner_free(PirateProto2ProtocolLearner *instance)
+{
+    furi_assert(instance);
+    furi_mutex_free(instance->mutex);
+    free(instance);
+}
+
+void pirateproto2_protocol_learner_reset(PirateProto2ProtocolLearner *instance)
+{
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    memset(&instance->result, 0, sizeof(instance->result));
+    instance->burst_count = 0;
+    instance->in_burst = false;
+    instance->overflow = false;
+    instance->pending_count = 0;
+    instance->pending_ready = false;
+    furi_mutex_release(instance->mutex);
+}
+
+void pirateproto2_protocol_learner_feed(void *context, bool level, uint32_t duration)
+{
+    PirateProto2ProtocolLearner *instance = context;
+    uint16_t sample = MIN(duration, (uint32_t)UINT16_MAX);
+
+    if (!level && duration >= PIRATEPROTO2_LEARNER_GAP)
+    {
+        if (instance->in_burst && !instance->overflow && instance->burst_count >= BURST_MIN)
+        {
+            furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+            // Bursts arriving while the last one is analysed are dropped
+            if (!instance->pending_ready)
+            {
+                memcpy(
+                    instance->pending,
+                    instance->burst,
+                    instance->burst_count * sizeof(uint16_t));
+                instance->pending[instance->burst_count] = sample;
+                instance->pending_count = instance->burst_count + 1;
+                instance->pending_ready = true;
+            }
+            furi_mutex_release(instance->mutex);
+        }
+        instance->in_burst = false;
+        instance->overflow = false;
+        instance->burst_count = 0;
+        return;
+    }
+
+    if (!instance->in_burst)
+    {
+        // Bursts always start on a high
+        if (!level)
+        {
+            return;
+        }
+        instance->in_burst = true;
+    }
+    // Keep one slot for the closing gap
+    if (instance->burst_count < PIRATEPROTO2_LEARNER_BURST_MAX - 1)
+    {
+        instance->burst[instance->burst_count++] = sample;
+    }
+    else
+    {
+        instance->overflow = true;
+    }
+}
+
+void pirateproto2_protocol_learner_break_burst(PirateProto2ProtocolLearner *instance)
+{
+    furi_assert(instance);
+    instance->in_burst = false;
+    instance->overflow = false;
+    instance->burst_count = 0;
+}
+
+bool pirateproto2_protocol_learner_process(PirateProto2ProtocolLearner *instance)
+{
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    bool ready = instance->pending_ready;
+    furi_mutex_release(instance->mutex);
+    if (!ready)
+    {
+        return false;
+    }
+
+    // feed leaves pending alone until it is released below
+    PirateProto2LearnerResult candidate = {0};
+    bool valid = pirateproto2_protocol_learner_analyse(
+        instance->pending, instance->pending_count, &candidate);
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    PirateProto2LearnerResult *result = &instance->result;
+    result->bursts++;
+    if (valid)
+    {
+        if (result->valid &&
+            pirateproto2_protocol_learner_is_same(&result->descriptor, &candidate.descriptor))
+        {
+            result->matches++;
+            result->confidence = (result->confidence * 3 + candidate.confidence) / 4;
+        }
+        else
+        {
+            result->descriptor = candidate.descriptor;
+            result->confidence = candidate.confidence;
+            result->matches = 1;
+            result->valid = true;
+            FURI_LOG_I(
+                TAG,
+                "Coding %d, %u bits, te %u/%u",
+                result->descriptor.coding,
+                result->descriptor.timing.min_count_bit_for_found,
+                result->descriptor.timing.te_short,
+                result->descriptor.timing.te_long);
+        }
+    }
+    instance->pending_ready = false;
+    furi_mutex_release(instance->mutex);
+
+    return valid;
+}
+
+void pirateproto2_protocol_learner_get_result(
+    PirateProto2ProtocolLearner *instance,
+    PirateProto2LearnerResult *result)
+{
+    furi_assert(instance);
+    furi_assert(result);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    *result = instance->result;
+    furi_mutex_release(instance->mutex);
+}
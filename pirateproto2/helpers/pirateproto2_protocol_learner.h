@@ -0,0 +1,55 @@
+// helpers/pirateproto2_protocol_learner.h
+#pragma once
+
+#include <furi.h>
+#include "../protocols/pwm_protocol.h"
+
+// Longest burst kept, in durations
+#define PIRATEPROTO2_LEARNER_BURST_MAX 512
+// A low at least this long ends a burst
+#define PIRATEPROTO2_LEARNER_GAP       4000
+
+/**
+ * Infers the line coding of an unknown OOK remote from live RX.
+ *
+ * The worker side only copies bursts, the analysis runs from
+ * pirateproto2_protocol_learner_process() on the UI thread. Each burst is
+ * split into te_short/te_long, its preamble and sync are measured and the
+ * data is matched against PWM, PPM and Manchester. The result is a
+ * PirateProto2PwmDescriptor that subghz_protocol_decoder_pwm_alloc() runs
+ * as is, serial/button/counter fields are left for the user to place.
+ */
+typedef struct PirateProto2ProtocolLearner PirateProto2ProtocolLearner;
+
+typedef struct
+{
+    // Bursts analysed since the last reset
+    uint32_t bursts;
+    // Consecutive bursts that produced this descriptor
+    uint32_t matches;
+    // Share of data durations that fit the coding, 0-100
+    uint8_t confidence;
+    bool valid;
+    PirateProto2PwmDescriptor descriptor;
+} PirateProto2LearnerResult;
+
+// Name-only protocol the learned descriptors point at, never registered
+extern const SubGhzProtocol pirateproto2_learned_protocol;
+
+PirateProto2ProtocolLearner *pirateproto2_protocol_learner_alloc(void);
+void pirateproto2_protocol_learner_free(PirateProto2ProtocolLearner *instance);
+void pirateproto2_protocol_learner_reset(PirateProto2ProtocolLearner *instance);
+
+/** Worker pair callback, only buffers the burst */
+void pirateproto2_protocol_learner_feed(void *context, bool level, uint32_t duration);
+
+/** Drop the burst in progress, e.g. after a worker overrun */
+void pirateproto2_protocol_learner_break_burst(PirateProto2ProtocolLearner *instance);
+
+/** Analyse the pending burst, true if the result changed */
+bool pirateproto2_protocol_learner_process(PirateProto2ProtocolLearner *instance);
+
+/** Consistent copy for the UI */
+void pirateproto2_protocol_learner_get_result(
+    PirateProto2ProtocolLearner *instance,
+    PirateProto2LearnerResult *result);
@@ -0,0 +1,223 @@
+// helpers/pirateproto2_signal_analyzer.c
+#include "pirateproto2_signal_analyzer.h"
+
+#define TAG "PirateProto2SignalAnalyzer"
+
+// Bin 0 starts at 2^6 us
+#define HISTOGRAM_MSB_MIN 6
+// Centroids are kept in Q4, each step moves them 1/8 of the way to the sample
+#define CLUSTER_Q     4
+#define CLUSTER_RATE  3
+// Samples each centroid needs before it is reported
+#define CLUSTER_READY 8
+// Frames shorter than this are counted as noise
+#define FRAME_PULSES_MIN 8
+
+struct PirateProto2SignalAnalyzer
+{
+    FuriMutex *mutex;
+    PirateProto2SignalStats stats;
+
+    uint32_t centroid[2];
+    uint16_t centroid_hits[2];
+    uint8_t centroid_count;
+
+    bool in_frame;
+    uint16_t frame_pulses;
+    uint32_t frame_duration;
+};
+
+static uint8_t pirateproto2_signal_analyzer_get_bin(uint32_t duration)
+{
+    if (duration < (1UL << HISTOGRAM_MSB_MIN))
+    {
+        return 0;
+    }
+    uint8_t msb = 31 - __builtin_clz(duration);
+    uint8_t sub = (duration >> (msb - 2)) & 3;
+    uint32_t bin = (msb - HISTOGRAM_MSB_MIN) * 4 + sub;
+    return MIN(bin, PIRATEPROTO2_SIGNAL_HISTOGRAM_BINS - 1);
+}
+
+uint32_t pirateproto2_signal_analyzer_get_bin_duration(uint8_t bin)
+{
+    uint8_t msb = HISTOGRAM_MSB_MIN + bin / 4;
+    return (4UL + bin % 4) << (msb - 2);
+}
+
+static void pirateproto2_signal_analyzer_count(uint16_t *histogram, uint32_t duration)
+{
+    uint8_t bin = pirateproto2_signal_analyzer_get_bin(duration);
+    if (histogram[bin] == UINT16_MAX)
+    {
+        // Age the whole histogram instead of saturating, keeps the shape
+        for (uint8_t i = 0; i < PIRATEPROTO2_SIGNAL_HISTOGRAM_BINS; i++)
+        {
+            histogram[i] >>= 1;
+        }
+    }
+    histogram[bin]++;
+}
+
+static void pirateproto2_signal_analyzer_cluster(
+    PirateProto2SignalAnalyzer *instance,
+    uint32_t duration)
+{
+    uint32_t sample = duration << CLUSTER_Q;
+
+    // Seed the two centroids from the first two clearly different durations
+    if (instance->centroid_count == 0)
+    {
+        instance->centroid[0] = sample;
+        instance->centroid_count = 1;
+        return;
+    }
+    if (instance->centroid_count == 1)
+    {
+        uint32_t seed = instance->centroid[0];
+        if (sample * 2 > seed * 3)
+        {
+            instance->centroid[1] = sample;
+        }
+        else if (seed * 2 > sample * 3)
+        {
+            instance->centroid[1] = seed;
+            instance->centroid[0] = sample;
+        }
+        else
+        {
+            instance->centroid[0] = (seed + sample) / 2;
+            return;
+        }
+        instance->centroid_count = 2;
+        return;
+    }
+
+    // Midpoint split, same as picking the nearest centroid
+    uint8_t nearest = sample * 2 > instance->centroid[0] + instance->centroid[1] ? 1 : 0;
+
+    int32_t delta = (int32_t)(sample - instance->centroid[nearest]);
+    instance->centroid[nearest] += delta / (1 << CLUSTER_RATE);
+    if (instance->centroid_hits[nearest] < UINT16_MAX)
+    {
+        instance->centroid_hits[nearest]++;
+    }
+
+    if (instance->centroid[0] > instance->centroid[1])
+    {
+        uint32_t centroid = instance->centroid[0];
+        instance->centroid[0] = instance->centroid[1];
+        instance->centroid[1] = centroid;
+        uint16_t hits = instance->centroid_hits[0];
+        instance->centroid_hits[0] = instance->centroid_hits[1];
+        instance->centroid_hits[1] = hits;
+    }
+
+    if (instance->centroid_hits[0] >= CLUSTER_READY &&
+        instance->centroid_hits[1] >= CLUSTER_READY)
+    {
+        instance->stats.te_short = instance->centroid[0] >> CLUSTER_Q;
+        instance->stats.te_long = instance->centroid[1] >> CLUSTER_Q;
+        instance->stats.gap =
+            MAX((uint32_t)PIRATEPROTO2_SIGNAL_GAP_MIN, instance->stats.te_long * 4UL);
+    }
+}
+
+static void pirateproto2_signal_analyzer_end_frame(PirateProto2SignalAnalyzer *instance)
+{
+    if (instance->in_frame && instance->frame_pulses >= FRAME_PULSES_MIN)
+    {
+        instance->stats.frame_count++;
+        instance->stats.last_frame_pulses = instance->frame_pulses;
+        instance->stats.last_frame_duration = instance->frame_duration;
+    }
+    instance->in_frame = false;
+    instance->frame_pulses = 0;
+    instance->frame_duration = 0;
+}
+
+PirateProto2SignalAnalyzer *pirateproto2_signal_analyzer_alloc(void)
+{
+    PirateProto2SignalAnalyzer *instance = malloc(sizeof(PirateProto2SignalAnalyzer));
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    pirateproto2_signal_analyzer_reset(instance);
+    return instance;
+}
+
+void pirateproto2_signal_analyzer_free(PirateProto2SignalAnalyzer *instance)
+{
+    furi_assert(instance);
+    furi_mutex_free(instance->mutex);
+    free(instance);
+}
+
+void pirateproto2_signal_analyzer_reset(PirateProto2SignalAnalyzer *instance)
+{
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    memset(&instance->stats, 0, sizeof(instance->stats));
+    instance->stats.gap = PIRATEPROTO2_SIGNAL_GAP_MIN;
+    instance->centroid[0] = 0;
+    instance->centroid[1] = 0;
+    instance->centroid_hits[0] = 0;
+    instance->centroid_hits[1] = 0;
+    instance->centroid_count = 0;
+    instance->in_frame = false;
+    instance->frame_pulses = 0;
+    instance->frame_duration = 0;
+    furi_mutex_release(instance->mutex);
+}
+
+void pirateproto2_signal_analyzer_feed(void *context, bool level, uint32_t duration)
+{
+    PirateProto2SignalAnalyzer *instance = context;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+
+    instance->stats.pulse_count++;
+    pirateproto2_signal_analyzer_count(
+        level ? instance->stats.high : instance->stats.low, duration);
+
+    if (!level && duration >= instance->stats.gap)
+    {
+        pirateproto2_signal_analyzer_end_frame(instance);
+    }
+    else
+    {
+        if (level && !instance->in_frame)
+        {
+            instance->in_frame = true;
+        }
+        if (instance->in_frame)
+        {
+            if (instance->frame_pulses < UINT16_MAX)
+            {
+                instance->frame_pulses++;
+            }
+            instance->frame_duration += duration;
+            pirateproto2_signal_analyzer_cluster(instance, duration);
+        }
+    }
+
+    furi_mutex_release(instance->mutex);
+}
+
+void pirateproto2_signal_analyzer_break_frame(PirateProto2SignalAnalyzer *instance)
+{
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    instance->in_frame = false;
+    instance->frame_pulses = 0;
+    instance->frame_duration = 0;
+    furi_mutex_release(instance->mutex);
+}
+
+void pirateproto2_signal_analyzer_get_stats(
+    PirateProto2SignalAnalyzer *instance,
+    PirateProto2SignalStats *stats)
+{
+    furi_assert(instance);
+    furi_assert(stats);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    *stats = instance->stats;
+    furi_mutex_release(instance->mutex);
+}
@@ -0,0 +1,51 @@
+// helpers/pirateproto2_signal_analyzer.h
+#pragma once
+
+#include <furi.h>
+
+// 4 bins per octave from 64us (bin 0) up to ~32ms (last bin)
+#define PIRATEPROTO2_SIGNAL_HISTOGRAM_BINS 36
+// Lowest duration that ends a frame, raised to 4x te_long once that is known
+#define PIRATEPROTO2_SIGNAL_GAP_MIN 3000
+
+/**
+ * Streaming pulse statistics for live RX.
+ *
+ * Every pulse costs a bin lookup, one k-means step and a gap check, the
+ * memory footprint doesn't depend on how long the analyzer runs. High and
+ * low durations go to log-binned histograms, an online 2-means over all
+ * in-frame durations tracks te_short/te_long, and long lows split frames.
+ */
+typedef struct PirateProto2SignalAnalyzer PirateProto2SignalAnalyzer;
+
+typedef struct
+{
+    uint32_t pulse_count;
+    uint32_t frame_count;
+    // 0 until the clusters have seen enough pulses
+    uint16_t te_short;
+    uint16_t te_long;
+    uint32_t gap;
+    uint16_t last_frame_pulses;
+    uint32_t last_frame_duration;
+    uint16_t high[PIRATEPROTO2_SIGNAL_HISTOGRAM_BINS];
+    uint16_t low[PIRATEPROTO2_SIGNAL_HISTOGRAM_BINS];
+} PirateProto2SignalStats;
+
+PirateProto2SignalAnalyzer *pirateproto2_signal_analyzer_alloc(void);
+void pirateproto2_signal_analyzer_free(PirateProto2SignalAnalyzer *instance);
+void pirateproto2_signal_analyzer_reset(PirateProto2SignalAnalyzer *instance);
+
+/** Worker pair callback, safe to run next to the decoders */
+void pirateproto2_signal_analyzer_feed(void *context, bool level, uint32_t duration);
+
+/** Drop the frame in progress, e.g. after a worker overrun */
+void pirateproto2_signal_analyzer_break_frame(PirateProto2SignalAnalyzer *instance);
+
+/** Consistent copy for the UI */
+void pirateproto2_signal_analyzer_get_stats(
+    PirateProto2SignalAnalyzer *instance,
+    PirateProto2SignalStats *stats);
+
+/** Lower edge of a histogram bin in us */
+uint32_t pirateproto2_signal_analyzer_get_bin_duration(uint8_t bin);
@@ -28,6 +28,22 @@ static void pirateproto2_app_tick_event_callback(void *context)
     scene_manager_handle_tick_event(app->scene_manager);
 }
 
+static void pirateproto2_app_worker_pair_callback(void *context, bool level, uint32_t duration)
+{
+    PirateProto2App *app = context;
+    pirateproto2_signal_analyzer_feed(app->signal_analyzer, level, duration);
+    pirateproto2_protocol_learner_feed(app->protocol_learner, level, duration);
+    subghz_receiver_decode(app->txrx->receiver, level, duration);
+}
+
+static void pirateproto2_app_worker_overrun_callback(void *context)
+{
+    PirateProto2App *app = context;
+    pirateproto2_signal_analyzer_break_frame(app->signal_analyzer);
+    pirateproto2_protocol_learner_break_burst(app->protocol_learner);
+    subghz_receiver_reset(app->txrx->receiver);
+}
+
 PirateProto2App *pirateproto2_app_alloc()
 {
     PirateProto2App *app = malloc(sizeof(PirateProto2App));
@@ -171,19 +187,17 @@ PirateProto2App *pirateproto2_app_alloc()
     subghz_receiver_set_filter(app->txrx->receiver, 
         SubGhzProtocolFlag_Decodable | SubGhzProtocolFlag_Send | SubGhzProtocolFlag_Save);
 
-    // Set up worker callbacks with enhanced features
-    subghz_worker_set_overrun_callback(
-        app->txrx->worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
-    subghz_worker_set_pair_callback(
-        app->txrx->worker, (SubGhzWorkerPairCallback)subghz_receiver_decode);
-    subghz_worker_set_context(app->txrx->worker, app->txrx->receiver);
-
     // Initialize signal analysis module (NEW)
     app->signal_analyzer = pirateproto2_signal_analyzer_alloc();
-    
+
     // Initialize protocol learning module (NEW)
     app->protocol_learner = pirateproto2_protocol_learner_alloc();
 
+    // Set up worker callbacks, analyzer and learner tap every pulse before the decoders
+    subghz_worker_set_overrun_callback(app->txrx->worker, pirateproto2_app_worker_overrun_callback);
+    subghz_worker_set_pair_callback(app->txrx->worker, pirateproto2_app_worker_pair_callback);
+    subghz_worker_set_context(app->txrx->worker, app);
+
     furi_hal_power_suppress_charge_enter();
 
     scene_manager_next_scene(app->scene_manager, PirateProto2SceneStart);
@@ -1,588 +0,0 @@
-#include "ford_v0.h"
-
-#define TAG "FordProtocolV0"
-
-static const SubGhzBlockConst subghz_protocol_ford_v0_const = {
-    .te_short = 250,
-    .te_long = 500,
-    .te_delta = 100,
-    .min_count_bit_for_found = 64,
-};
-
-typedef struct SubGhzProtocolDecoderFordV0
-{
-    SubGhzProtocolDecoderBase base;
-    SubGhzBlockDecoder decoder;
-    SubGhzBlockGeneric generic;
-
-    ManchesterState manchester_state;
-
-    uint64_t data_low;
-    uint64_t data_high;
-    uint8_t bit_count;
-
-    uint16_t header_count;
-
-    uint64_t key1;
-    uint16_t key2;
-    uint32_t serial;
-    uint8_t button;
-    uint32_t count;
-} SubGhzProtocolDecoderFordV0;
-
-typedef struct SubGhzProtocolEncoderFordV0
-{
-    SubGhzProtocolEncoderBase base;
-    SubGhzProtocolBlockEncoder encoder;
-    SubGhzBlockGeneric generic;
-} SubGhzProtocolEncoderFordV0;
-
-typedef enum
-{
-    FordV0DecoderStepReset = 0,
-    FordV0DecoderStepPreamble,
-    FordV0DecoderStepPreambleCheck,
-    FordV0DecoderStepGap,
-    FordV0DecoderStepData,
-} FordV0DecoderStep;
-
-// Forward declarations
-static void ford_v0_add_bit(SubGhzProtocolDecoderFordV0 *instance, bool bit);
-static void decode_ford_v0(uint64_t key1, uint16_t key2, uint32_t *serial, uint8_t *button, uint32_t *count);
-static bool ford_v0_process_data(SubGhzProtocolDecoderFordV0 *instance);
-
-const SubGhzProtocolDecoder subghz_protocol_ford_v0_decoder = {
-    .alloc = subghz_protocol_decoder_ford_v0_alloc,
-    .free = subghz_protocol_decoder_ford_v0_free,
-    .feed = subghz_protocol_decoder_ford_v0_feed,
-    .reset = subghz_protocol_decoder_ford_v0_reset,
-    .get_hash_data = subghz_protocol_decoder_ford_v0_get_hash_data,
-    .serialize = subghz_protocol_decoder_ford_v0_serialize,
-    .deserialize = subghz_protocol_decoder_ford_v0_deserialize,
-    .get_string = subghz_protocol_decoder_ford_v0_get_string,
-};
-
-// Encoder implementation
-void *subghz_protocol_encoder_ford_v0_alloc(SubGhzEnvironment *environment)
-{
-    UNUSED(environment);
-    SubGhzProtocolEncoderFordV0 *instance = malloc(sizeof(SubGhzProtocolEncoderFordV0));
-    instance->base.protocol = &ford_protocol_v0;
-    return instance;
-}
-
-void subghz_protocol_encoder_ford_v0_free(void *context)
-{
-    furi_assert(context);
-    SubGhzProtocolEncoderFordV0 *instance = context;
-    free(instance);
-}
-
-SubGhzProtocolStatus subghz_protocol_encoder_ford_v0_deserialize(void *context, FlipperFormat *flipper_format)
-{
-    furi_assert(context);
-    SubGhzProtocolEncoderFordV0 *instance = context;
-
-    SubGhzProtocolStatus res = SubGhzProtocolStatusError;
-    do
-    {
-        // Read protocol name and validate
-        FuriString *temp_str = furi_string_alloc();
-        if (!flipper_format_read_string(flipper_format, "Protocol", temp_str))
-        {
-            FURI_LOG_E(TAG, "Missing Protocol");
-            furi_string_free(temp_str);
-            break;
-        }
-
-        if (!furi_string_equal(temp_str, instance->base.protocol->name))
-        {
-            FURI_LOG_E(TAG, "Wrong protocol %s != %s",
-                       furi_string_get_cstr(temp_str), instance->base.protocol->name);
-            furi_string_free(temp_str);
-            break;
-        }
-        furi_string_free(temp_str);
-
-        // Read bit count as uint32_t first
-        uint32_t bit_count_temp;
-        if (!flipper_format_read_uint32(flipper_format, "Bit", &bit_count_temp, 1))
-        {
-            FURI_LOG_E(TAG, "Missing Bit");
-            break;
-        }
-        instance->generic.data_count_bit = (uint16_t)bit_count_temp;
-
-        if (instance->generic.data_count_bit != 64)
-        {
-            FURI_LOG_E(TAG, "Wrong bit count %u", instance->generic.data_count_bit);
-            break;
-        }
-
-        // Read key data
-        temp_str = furi_string_alloc();
-        if (!flipper_format_read_string(flipper_format, "Key", temp_str))
-        {
-            FURI_LOG_E(TAG, "Missing Key");
-            furi_string_free(temp_str);
-            break;
-        }
-
-        // Parse hex key
-        uint64_t key = 0;
-        if (sscanf(furi_string_get_cstr(temp_str), "%016llX", &key) != 1)
-        {
-            FURI_LOG_E(TAG, "Failed to parse Key");
-            furi_string_free(temp_str);
-            break;
-        }
-        furi_string_free(temp_str);
-
-        instance->generic.data = key;
-
-        // Read additional Ford-specific fields
-        uint32_t bs_val, crc_val;
-        if (flipper_format_read_uint32(flipper_format, "BS", &bs_val, 1))
-        {
-            // Store BS and CRC in the upper 16 bits of data
-            instance->generic.data |= ((uint64_t)(bs_val & 0xFF) << 56);
-        }
-        
-        if (flipper_format_read_uint32(flipper_format, "CRC", &crc_val, 1))
-        {
-            instance->generic.data |= ((uint64_t)(crc_val & 0xFF) << 48);
-        }
-
-        res = SubGhzProtocolStatusOk;
-    } while (false);
-
-    return res;
-}
-
-void subghz_protocol_encoder_ford_v0_stop(void *context)
-{
-    UNUSED(context);
-}
-
-LevelDuration subghz_protocol_encoder_ford_v0_yield(void *context)
-{
-    furi_assert(context);
-    SubGhzProtocolEncoderFordV0 *instance = context;
-
-    // Ford V0 uses Manchester encoding
-    // This is a simplified implementation - you may need to adjust based on actual protocol timing
-    static uint8_t bit_index = 0;
-    static bool is_high = true;
-    static uint8_t preamble_count = 0;
-
-    // Send preamble
-    if (preamble_count < 16)
-    {
-        if (is_high)
-        {
-            is_high = false;
-            return level_duration_make(true, subghz_protocol_ford_v0_const.te_short);
-        }
-        else
-        {
-            is_high = true;
-            preamble_count++;
-            return level_duration_make(false, subghz_protocol_ford_v0_const.te_short);
-        }
-    }
-
-    // Send sync
-    if (preamble_count == 16)
-    {
-        preamble_count++;
-        return level_duration_make(true, subghz_protocol_ford_v0_const.te_long);
-    }
-
-    if (preamble_count == 17)
-    {
-        preamble_count++;
-        bit_index = 0;
-        is_high = true;
-        return level_duration_make(false, subghz_protocol_ford_v0_const.te_long);
-    }
-
-    // Send data bits (Manchester encoding)
-    if (bit_index < instance->generic.data_count_bit)
-    {
-        bool current_bit = (instance->generic.data >> (63 - bit_index)) & 1;
-        
-        if (is_high)
-        {
-            is_high = false;
-            // Manchester: 0 = short high then long low, 1 = long high then short low
-            uint32_t duration = current_bit ? subghz_protocol_ford_v0_const.te_long : subghz_protocol_ford_v0_const.te_short;
-            return level_duration_make(true, duration);
-        }
-        else
-        {
-            is_high = true;
-            bit_index++;
-            uint32_t duration = current_bit ? subghz_protocol_ford_v0_const.te_short : subghz_protocol_ford_v0_const.te_long;
-            
-            if (bit_index >= instance->generic.data_count_bit)
-            {
-                // Reset for next transmission
-                preamble_count = 0;
-                bit_index = 0;
-                return level_duration_make(false, duration + 10000); // Add gap
-            }
-            
-            return level_duration_make(false, duration);
-        }
-    }
-
-    return level_duration_reset();
-}
-
-const SubGhzProtocolEncoder subghz_protocol_ford_v0_encoder = {
-    .alloc = subghz_protocol_encoder_ford_v0_alloc,
-    .free = subghz_protocol_encoder_ford_v0_free,
-    .deserialize = subghz_protocol_encoder_ford_v0_deserialize,
-    .stop = subghz_protocol_encoder_ford_v0_stop,
-    .yield = subghz_protocol_encoder_ford_v0_yield,
-};
-
-const SubGhzProtocol ford_protocol_v0 = {
-    .name = FORD_PROTOCOL_V0_NAME,
-    .type = SubGhzProtocolTypeDynamic,
-    .flag = SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable | SubGhzProtocolFlag_Save | SubGhzProtocolFlag_Send,
-    .decoder = &subghz_protocol_ford_v0_decoder,
-    .encoder = &subghz_protocol_ford_v0_encoder,
-};
-
-static void ford_v0_add_bit(SubGhzProtocolDecoderFordV0 *instance, bool bit)
-{
-    uint32_t low = (uint32_t)instance->data_low;
-    instance->data_low = (instance->data_low << 1) | (bit ? 1 : 0);
-    instance->data_high = (instance->data_high << 1) | ((low >> 31) & 1);
-    instance->bit_count++;
-}
-
-static void decode_ford_v0(uint64_t key1, uint16_t key2, uint32_t *serial, uint8_t *button, uint32_t *count)
-{
-    uint8_t buf[13] = {0};
-
-    for (int i = 0; i < 8; ++i)
-    {
-        buf[i] = (uint8_t)(key1 >> (56 - i * 8));
-    }
-
-    buf[8] = (uint8_t)(key2 >> 8);
-    buf[9] = (uint8_t)(key2 & 0xFF);
-
-    uint8_t tmp = buf[8];
-    uint8_t parity = 0;
-    uint8_t parity_any = (tmp != 0);
-    while (tmp)
-    {
-        parity ^= (tmp & 1);
-        tmp >>= 1;
-    }
-    buf[11] = parity_any ? parity : 0;
-
-    uint8_t xor_byte;
-    uint8_t limit;
-    if (buf[11])
-    {
-        xor_byte = buf[7];
-        limit = 7;
-    }
-    else
-    {
-        xor_byte = buf[6];
-        limit = 6;
-    }
-
-    for (int idx = 1; idx < limit; ++idx)
-    {
-        buf[idx] ^= xor_byte;
-    }
-
-    if (buf[11] == 0)
-    {
-        buf[7] ^= xor_byte;
-    }
-
-    uint8_t orig_b7 = buf[7];
-
-    buf[7] = (orig_b7 & 0xAA) | (buf[6] & 0x55);
-    uint8_t mixed = (buf[6] & 0xAA) | (orig_b7 & 0x55);
-    buf[12] = mixed;
-    buf[6] = mixed;
-
-    uint32_t serial_le = ((uint32_t)buf[1]) |
-                         ((uint32_t)buf[2] << 8) |
-                         ((uint32_t)buf[3] << 16) |
-                         ((uint32_t)buf[4] << 24);
-
-    *serial = ((serial_le & 0xFF) << 24) |
-              (((serial_le >> 8) & 0xFF) << 16) |
-              (((serial_le >> 16) & 0xFF) << 8) |
-              ((serial_le >> 24) & 0xFF);
-
-    *button = (buf[5] >> 4) & 0x0F;
-
-    *count = ((buf[5] & 0x0F) << 16) |
-             (buf[6] << 8) |
-             buf[7];
-}
-
-static bool ford_v0_process_data(SubGhzProtocolDecoderFordV0 *instance)
-{
-    if (instance->bit_count == 64)
-    {
-        uint64_t combined = ((uint64_t)instance->data_high << 32) | instance->data_low;
-        instance->key1 = ~combined;
-        instance->data_low = 0;
-        instance->data_high = 0;
-        return false;
-    }
-
-    if (instance->bit_count == 80)
-    {
-        uint16_t key2_raw = (uint16_t)(instance->data_low & 0xFFFF);
-        uint16_t key2 = ~key2_raw;
-
-        decode_ford_v0(instance->key1, key2, &instance->serial, &instance->button, &instance->count);
-        instance->key2 = key2;
-        return true;
-    }
-
-    return false;
-}
-
-void *subghz_protocol_decoder_ford_v0_alloc(SubGhzEnvironment *environment)
-{
-    UNUSED(environment);
-    SubGhzProtocolDecoderFordV0 *instance = malloc(sizeof(SubGhzProtocolDecoderFordV0));
-    instance->base.protocol = &ford_protocol_v0;
-    instance->generic.protocol_name = instance->base.protocol->name;
-    return instance;
-}
-
-void subghz_protocol_decoder_ford_v0_free(void *context)
-{
-    furi_assert(context);
-    SubGhzProtocolDecoderFordV0 *instance = context;
-    free(instance);
-}
-
-void subghz_protocol_decoder_ford_v0_reset(void *context)
-{
-    furi_assert(context);
-    SubGhzProtocolDecoderFordV0 *instance = context;
-    instance->decoder.parser_step = FordV0DecoderStepReset;
-    instance->decoder.te_last = 0;
-    instance->manchester_state = ManchesterStateMid1;
-    instance->data_low = 0;
-    instance->data_high = 0;
-    instance->bit_count = 0;
-    instance->header_count = 0;
-    instance->key1 = 0;
-    instance->key2 = 0;
-    instance->serial = 0;
-    instance->button = 0;
-    instance->count = 0;
-}
-
-void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t duration)
-{
-    furi_assert(context);
-    SubGhzProtocolDecoderFordV0 *instance = context;
-
-    uint32_t te_short = subghz_protocol_ford_v0_const.te_short;
-    uint32_t te_long = subghz_protocol_ford_v0_const.te_long;
-    uint32_t te_delta = subghz_protocol_ford_v0_const.te_delta;
-    uint32_t gap_threshold = 3500;
-
-    switch (instance->decoder.parser_step)
-    {
-    case FordV0DecoderStepReset:
-        if (level && (DURATION_DIFF(duration, te_short) < te_delta))
-        {
-            instance->data_low = 0;
-            instance->data_high = 0;
-            instance->decoder.parser_step = FordV0DecoderStepPreamble;
-            instance->decoder.te_last = duration;
-            instance->header_count = 0;
-            instance->bit_count = 0;
-            manchester_advance(instance->manchester_state, ManchesterEventReset, &instance->manchester_state, NULL);
-        }
-        break;
-
-    case FordV0DecoderStepPreamble:
-        if (!level)
-        {
-            if (DURATION_DIFF(duration, te_long) < te_delta)
-            {
-                instance->decoder.te_last = duration;
-                instance->decoder.parser_step = FordV0DecoderStepPreambleCheck;
-            }
-            else
-            {
-                instance->decoder.parser_step = FordV0DecoderStepReset;
-            }
-        }
-        break;
-
-    case FordV0DecoderStepPreambleCheck:
-        if (level)
-        {
-            if (DURATION_DIFF(duration, te_long) < te_delta)
-            {
-                instance->header_count++;
-                instance->decoder.te_last = duration;
-                instance->decoder.parser_step = FordV0DecoderStepPreamble;
-            }
-            else if (DURATION_DIFF(duration, te_short) < te_delta)
-            {
-                instance->decoder.parser_step = FordV0DecoderStepGap;
-            }
-            else
-            {
-                instance->decoder.parser_step = FordV0DecoderStepReset;
-            }
-        }
-        break;
-
-    case FordV0DecoderStepGap:
-        if (!level && (DURATION_DIFF(duration, gap_threshold) < 250))
-        {
-            instance->data_low = 1;
-            instance->data_high = 0;
-            instance->bit_count = 1;
-            instance->decoder.parser_step = FordV0DecoderStepData;
-        }
-        else if (!level && duration > gap_threshold + 250)
-        {
-            instance->decoder.parser_step = FordV0DecoderStepReset;
-        }
-        break;
-
-    case FordV0DecoderStepData:
-    {
-        ManchesterEvent event;
-
-        if (DURATION_DIFF(duration, te_short) < te_delta)
-        {
-            event = level ? ManchesterEventShortLow : ManchesterEventShortHigh;
-        }
-        else if (DURATION_DIFF(duration, te_long) < te_delta)
-        {
-            event = level ? ManchesterEventLongLow : ManchesterEventLongHigh;
-        }
-        else
-        {
-            instance->decoder.parser_step = FordV0DecoderStepReset;
-            break;
-        }
-
-        bool data_bit;
-        if (manchester_advance(instance->manchester_state, event, &instance->manchester_state, &data_bit))
-        {
-            ford_v0_add_bit(instance, data_bit);
-
-            if (ford_v0_process_data(instance))
-            {
-                instance->generic.data = instance->key1;
-                instance->generic.data_count_bit = 64;
-                instance->generic.serial = instance->serial;
-                instance->generic.btn = instance->button;
-                instance->generic.cnt = instance->count;
-
-                if (instance->base.callback)
-                {
-                    instance->base.callback(&instance->base, instance->base.context);
-                }
-
-                instance->data_low = 0;
-                instance->data_high = 0;
-                instance->bit_count = 0;
-                instance->decoder.parser_step = FordV0DecoderStepReset;
-            }
-        }
-
-        instance->decoder.te_last = duration;
-        break;
-    }
-    }
-}
-
-uint8_t subghz_protocol_decoder_ford_v0_get_hash_data(void *context)
-{
-    furi_assert(context);
-    SubGhzProtocolDecoderFordV0 *instance = context;
-    return subghz_protocol_blocks_get_hash_data(
-        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
-}
-
-SubGhzProtocolStatus subghz_protocol_decoder_ford_v0_serialize(
-    void *context,
-    FlipperFormat *flipper_format,
-    SubGhzRadioPreset *preset)
-{
-    furi_assert(context);
-    SubGhzProtocolDecoderFordV0 *instance = context;
-
-    SubGhzProtocolStatus ret = SubGhzProtocolStatusError;
-
-    ret = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
-
-    if (ret == SubGhzProtocolStatusOk)
-    {
-        // Add Ford-specific data
-        uint32_t temp = (instance->key2 >> 8) & 0xFF; // BS byte
-        flipper_format_write_uint32(flipper_format, "BS", &temp, 1);
-
-        temp = instance->key2 & 0xFF; // CRC byte
-        flipper_format_write_uint32(flipper_format, "CRC", &temp, 1);
-
-        // Ensure serial, button, count are saved
-        flipper_format_write_uint32(flipper_format, "Serial", &instance->serial, 1);
-
-        temp = instance->button;
-        flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
-
-        flipper_format_write_uint32(flipper_format, "Cnt", &instance->count, 1);
-    }
-
-    return ret;
-}
-
-SubGhzProtocolStatus subghz_protocol_decoder_ford_v0_deserialize(void *context, FlipperFormat *flipper_format)
-{
-    furi_assert(context);
-    SubGhzProtocolDecoderFordV0 *instance = context;
-    return subghz_block_generic_deserialize_check_count_bit(
-        &instance->generic, flipper_format, subghz_protocol_ford_v0_const.min_count_bit_for_found);
-}
-
-void subghz_protocol_decoder_ford_v0_get_string(void *context, FuriString *output)
-{
-    furi_assert(context);
-    SubGhzProtocolDecoderFordV0 *instance = context;
-
-    uint32_t code_found_hi = (uint32_t)(instance->key1 >> 32);
-    uint32_t code_found_lo = (uint32_t)(instance->key1 & 0xFFFFFFFF);
-
-    furi_string_cat_printf(
-        output,
-        "%s %dbit\r\n"
-        "Key:%08lX%08lX\r\n"
-        "Sn:%08lX Btn:%02X Cnt:%06lX\r\n"
-        "BS:%02X CRC:%02X\r\n",
-        instance->generic.protocol_name,
-        instance->generic.data_count_bit,
-        code_found_hi,
-        code_found_lo,
-        instance->serial,
-        instance->button,
-        instance->count,
-        (instance->key2 >> 8) & 0xFF,
-        instance->key2 & 0xFF);
-}
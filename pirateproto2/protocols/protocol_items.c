@@ -2,28 +2,11 @@
 
 // Enhanced protocol registry for PirateProto 2
 const SubGhzProtocol* pirateproto2_protocol_registry_items[] = {
-    // Enhanced KIA protocols with transmission support
-    &kia_protocol_v0,
-    &kia_protocol_v1,
-    &kia_protocol_v2,
-    &kia_protocol_v3_v4,
-    &kia_protocol_v5,
-    
-    // Enhanced Ford protocol with full transmission
-    &ford_protocol_v0,
-    
-    // Enhanced Subaru protocol with rolling code emulation
-    &subaru_protocol,
-    
-    // Enhanced Suzuki protocol
-    &suzuki_protocol,
-    
-    // Enhanced VW protocol
-    &vw_protocol,
-    
-    // Enhanced Fiat protocol
-    &fiat_protocol_v0,
-    
+    // Shared decoders
+#define PROTOPIRATE_PROTOCOL(protocol, ...) &protocol,
+#include "../../protocols/protocol_list.h"
+#undef PROTOPIRATE_PROTOCOL
+
     // NEW PROTOCOLS FOR PIRATEPROTO 2
     
     // Toyota protocols
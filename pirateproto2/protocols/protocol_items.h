@@ -2,27 +2,8 @@
 
 #include <lib/subghz/types.h>
 
-// Enhanced KIA protocols
-extern const SubGhzProtocol kia_protocol_v0;
-extern const SubGhzProtocol kia_protocol_v1;
-extern const SubGhzProtocol kia_protocol_v2;
-extern const SubGhzProtocol kia_protocol_v3_v4;
-extern const SubGhzProtocol kia_protocol_v5;
-
-// Enhanced Ford protocol
-extern const SubGhzProtocol ford_protocol_v0;
-
-// Enhanced Subaru protocol
-extern const SubGhzProtocol subaru_protocol;
-
-// Enhanced Suzuki protocol
-extern const SubGhzProtocol suzuki_protocol;
-
-// Enhanced VW protocol
-extern const SubGhzProtocol vw_protocol;
-
-// Enhanced Fiat protocol
-extern const SubGhzProtocol fiat_protocol_v0;
+// Shared decoders, same sources and list as the ProtoPirate app
+#include "../../protocols/protocol_items.h"
 
 // NEW PROTOCOLS FOR PIRATEPROTO 2
 
@@ -0,0 +1,328 @@
+#include "pwm_protocol.h"
+
+#include <inttypes.h>
+
+#define TAG "PwmProtocol"
+
+typedef enum {
+    PwmDecoderStepReset = 0,
+    PwmDecoderStepPreamble,
+    PwmDecoderStepSyncLow,
+    PwmDecoderStepDataHigh,
+    PwmDecoderStepDataLow,
+    PwmDecoderStepManchester,
+} PwmDecoderStep;
+
+struct SubGhzProtocolDecoderPwm {
+    SubGhzProtocolDecoderBase base;
+    SubGhzBlockDecoder decoder;
+    SubGhzBlockGeneric generic;
+
+    const PirateProto2PwmDescriptor* descriptor;
+    uint16_t header_count;
+    // PWM bit read from the high, committed once its low checks out
+    uint8_t pending_bit;
+    ManchesterState manchester_state;
+};
+
+const SubGhzProtocolEncoder subghz_protocol_pwm_encoder = {
+    .alloc = NULL,
+    .free = NULL,
+    .deserialize = NULL,
+    .stop = NULL,
+    .yield = NULL,
+};
+
+// 0 or 1 for a te_short or te_long duration, -1 for anything else
+static inline int8_t
+    pwm_get_symbol(const PirateProto2PwmDescriptor* descriptor, uint32_t duration) {
+    const SubGhzBlockConst* timing = &descriptor->timing;
+    if(DURATION_DIFF(duration, timing->te_short) < timing->te_delta) {
+        return descriptor->invert ? 1 : 0;
+    } else if(DURATION_DIFF(duration, timing->te_long) < timing->te_delta) {
+        return descriptor->invert ? 0 : 1;
+    }
+    return -1;
+}
+
+static inline bool pwm_is_short(const PirateProto2PwmDescriptor* descriptor, uint32_t duration) {
+    return DURATION_DIFF(duration, descriptor->timing.te_short) < descriptor->timing.te_delta;
+}
+
+static inline bool pwm_is_sync(
+    const PirateProto2PwmDescriptor* descriptor,
+    uint32_t duration,
+    uint16_t sync) {
+    return DURATION_DIFF(duration, sync) < descriptor->timing.te_delta;
+}
+
+static uint32_t pwm_get_field(uint64_t data, uint8_t bit_count, PirateProto2PwmField field) {
+    if(!field.length) return 0;
+    uint8_t shift = bit_count - field.start - field.length;
+    return (data >> shift) & ((1ULL << field.length) - 1);
+}
+
+static void pwm_extract_fields(SubGhzProtocolDecoderPwm* instance) {
+    const PirateProto2PwmDescriptor* descriptor = instance->descriptor;
+    uint64_t data = instance->generic.data;
+    uint8_t bit_count = instance->generic.data_count_bit;
+    instance->generic.serial = pwm_get_field(data, bit_count, descriptor->serial);
+    instance->generic.btn = pwm_get_field(data, bit_count, descriptor->btn);
+    instance->generic.cnt = pwm_get_field(data, bit_count, descriptor->cnt);
+}
+
+static bool pwm_field_fits(PirateProto2PwmField field, uint8_t bit_count) {
+    return field.length <= 32 && field.start + field.length <= bit_count;
+}
+
+void* subghz_protocol_decoder_pwm_alloc(const PirateProto2PwmDescriptor* descriptor) {
+    furi_assert(descriptor);
+    uint8_t bit_count = descriptor->timing.min_count_bit_for_found;
+    furi_check(bit_count > 0 && bit_count <= 64);
+    furi_check(pwm_field_fits(descriptor->serial, bit_count));
+    furi_check(pwm_field_fits(descriptor->btn, bit_count));
+    furi_check(pwm_field_fits(descriptor->cnt, bit_count));
+
+    SubGhzProtocolDecoderPwm* instance = malloc(sizeof(SubGhzProtocolDecoderPwm));
+    instance->base.protocol = descriptor->protocol;
+    instance->generic.protocol_name = instance->base.protocol->name;
+    instance->descriptor = descriptor;
+    subghz_protocol_decoder_pwm_reset(instance);
+    return instance;
+}
+
+void subghz_protocol_decoder_pwm_free(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPwm* instance = context;
+    free(instance);
+}
+
+void subghz_protocol_decoder_pwm_reset(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPwm* instance = context;
+    instance->decoder.parser_step = PwmDecoderStepReset;
+    instance->header_count = 0;
+}
+
+static void pwm_frame_done(SubGhzProtocolDecoderPwm* instance) {
+    const PirateProto2PwmDescriptor* descriptor = instance->descriptor;
+    if(instance->decoder.decode_count_bit == descriptor->timing.min_count_bit_for_found) {
+        instance->generic.data = instance->decoder.decode_data;
+        instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+        pwm_extract_fields(instance);
+
+        if(instance->base.callback) {
+            instance->base.callback(&instance->base, instance->base.context);
+        }
+    }
+    instance->decoder.parser_step = PwmDecoderStepReset;
+}
+
+void subghz_protocol_decoder_pwm_feed(void* context, bool level, uint32_t duration) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPwm* instance = context;
+    const PirateProto2PwmDescriptor* descriptor = instance->descriptor;
+
+    switch(instance->decoder.parser_step) {
+    case PwmDecoderStepReset:
+        if(!level || descriptor->coding == PirateProto2PwmCodingNone) break;
+        if(descriptor->preamble_count) {
+            if(pwm_is_short(descriptor, duration)) {
+                instance->header_count = 1;
+                instance->decoder.parser_step = PwmDecoderStepPreamble;
+            }
+        } else if(pwm_is_sync(descriptor, duration, descriptor->sync_high)) {
+            instance->decoder.parser_step = PwmDecoderStepSyncLow;
+        }
+        break;
+
+    case PwmDecoderStepPreamble:
+        if(!level) {
+            if(!pwm_is_short(descriptor, duration)) {
+                instance->decoder.parser_step = PwmDecoderStepReset;
+            }
+        } else if(pwm_is_short(descriptor, duration)) {
+            if(instance->header_count < UINT16_MAX) instance->header_count++;
+        } else if(
+            instance->header_count >= descriptor->preamble_count &&
+            pwm_is_sync(descriptor, duration, descriptor->sync_high)) {
+            instance->decoder.parser_step = PwmDecoderStepSyncLow;
+        } else {
+            instance->decoder.parser_step = PwmDecoderStepReset;
+        }
+        break;
+
+    case PwmDecoderStepSyncLow:
+        if(!level && pwm_is_sync(descriptor, duration, descriptor->sync_low)) {
+            instance->decoder.decode_data = 0;
+            instance->decoder.decode_count_bit = 0;
+            if(descriptor->coding == PirateProto2PwmCodingManchester) {
+                manchester_advance(
+                    ManchesterStateMid1,
+                    ManchesterEventReset,
+                    &instance->manchester_state,
+                    NULL);
+                instance->decoder.parser_step = PwmDecoderStepManchester;
+            } else {
+                instance->decoder.parser_step = PwmDecoderStepDataHigh;
+            }
+        } else {
+            instance->decoder.parser_step = PwmDecoderStepReset;
+        }
+        break;
+
+    case PwmDecoderStepDataHigh:
+        if(!level) {
+            instance->decoder.parser_step = PwmDecoderStepReset;
+        } else if(descriptor->coding == PirateProto2PwmCodingPwm) {
+            int8_t symbol = pwm_get_symbol(descriptor, duration);
+            if(symbol < 0) {
+                instance->decoder.parser_step = PwmDecoderStepReset;
+            } else {
+                instance->pending_bit = symbol;
+                instance->decoder.parser_step = PwmDecoderStepDataLow;
+            }
+        } else if(pwm_is_short(descriptor, duration)) {
+            instance->decoder.parser_step = PwmDecoderStepDataLow;
+        } else {
+            instance->decoder.parser_step = PwmDecoderStepReset;
+        }
+        break;
+
+    case PwmDecoderStepDataLow:
+        if(level) {
+            instance->decoder.parser_step = PwmDecoderStepReset;
+            break;
+        }
+        if(descriptor->coding == PirateProto2PwmCodingPwm) {
+            // The low of a PWM bit only has to be a valid symbol, the gap closes the last bit
+            bool gap = duration >= descriptor->gap;
+            if(!gap && pwm_get_symbol(descriptor, duration) < 0) {
+                instance->decoder.parser_step = PwmDecoderStepReset;
+                break;
+            }
+            subghz_protocol_blocks_add_bit(&instance->decoder, instance->pending_bit);
+            if(gap) {
+                pwm_frame_done(instance);
+                break;
+            }
+        } else if(duration >= descriptor->gap) {
+            // PPM frames end with a stop pulse whose low is the gap
+            pwm_frame_done(instance);
+            break;
+        } else {
+            int8_t symbol = pwm_get_symbol(descriptor, duration);
+            if(symbol < 0) {
+                instance->decoder.parser_step = PwmDecoderStepReset;
+                break;
+            }
+            subghz_protocol_blocks_add_bit(&instance->decoder, symbol);
+        }
+
+        if(instance->decoder.decode_count_bit > descriptor->timing.min_count_bit_for_found) {
+            instance->decoder.parser_step = PwmDecoderStepReset;
+        } else {
+            instance->decoder.parser_step = PwmDecoderStepDataHigh;
+        }
+        break;
+
+    case PwmDecoderStepManchester: {
+        if(!level && duration >= descriptor->gap) {
+            pwm_frame_done(instance);
+            break;
+        }
+
+        const SubGhzBlockConst* timing = &descriptor->timing;
+        ManchesterEvent event;
+        if(DURATION_DIFF(duration, timing->te_short) < timing->te_delta) {
+            event = level ? ManchesterEventShortLow : ManchesterEventShortHigh;
+        } else if(DURATION_DIFF(duration, timing->te_long) < timing->te_delta) {
+            event = level ? ManchesterEventLongLow : ManchesterEventLongHigh;
+        } else {
+            instance->decoder.parser_step = PwmDecoderStepReset;
+            break;
+        }
+
+        bool data_bit;
+        if(manchester_advance(
+               instance->manchester_state, event, &instance->manchester_state, &data_bit)) {
+            subghz_protocol_blocks_add_bit(&instance->decoder, data_bit ^ descriptor->invert);
+            if(instance->decoder.decode_count_bit > timing->min_count_bit_for_found) {
+                instance->decoder.parser_step = PwmDecoderStepReset;
+            }
+        }
+        break;
+    }
+    }
+}
+
+uint8_t subghz_protocol_decoder_pwm_get_hash_data(void* context) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPwm* instance = context;
+    return subghz_protocol_blocks_get_hash_data(
+        &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
+}
+
+SubGhzProtocolStatus subghz_protocol_decoder_pwm_serialize(
+    void* context,
+    FlipperFormat* flipper_format,
+    SubGhzRadioPreset* preset) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPwm* instance = context;
+    const PirateProto2PwmDescriptor* descriptor = instance->descriptor;
+
+    SubGhzProtocolStatus ret =
+        subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
+
+    if(ret == SubGhzProtocolStatusOk) {
+        if(descriptor->serial.length) {
+            flipper_format_write_uint32(flipper_format, "Serial", &instance->generic.serial, 1);
+        }
+        if(descriptor->btn.length) {
+            uint32_t temp = instance->generic.btn;
+            flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
+        }
+        if(descriptor->cnt.length) {
+            flipper_format_write_uint32(flipper_format, "Cnt", &instance->generic.cnt, 1);
+        }
+    }
+
+    return ret;
+}
+
+SubGhzProtocolStatus
+    subghz_protocol_decoder_pwm_deserialize(void* context, FlipperFormat* flipper_format) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPwm* instance = context;
+    SubGhzProtocolStatus ret = subghz_block_generic_deserialize_check_count_bit(
+        &instance->generic, flipper_format, instance->descriptor->timing.min_count_bit_for_found);
+    if(ret == SubGhzProtocolStatusOk) {
+        pwm_extract_fields(instance);
+    }
+    return ret;
+}
+
+void subghz_protocol_decoder_pwm_get_string(void* context, FuriString* output) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPwm* instance = context;
+    const PirateProto2PwmDescriptor* descriptor = instance->descriptor;
+
+    furi_string_cat_printf(
+        output,
+        "%s %dbit\r\n"
+        "Key:%08" PRIX32 "%08" PRIX32 "\r\n",
+        instance->generic.protocol_name,
+        instance->generic.data_count_bit,
+        (uint32_t)(instance->generic.data >> 32),
+        (uint32_t)(instance->generic.data & 0xFFFFFFFF));
+
+    if(descriptor->serial.length) {
+        furi_string_cat_printf(output, "Sn:%07" PRIX32 " ", instance->generic.serial);
+    }
+    if(descriptor->btn.length) {
+        furi_string_cat_printf(output, "Btn:%X ", instance->generic.btn);
+    }
+    if(descriptor->cnt.length) {
+        furi_string_cat_printf(output, "Cnt:%04" PRIX32, instance->generic.cnt);
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <furi.h>
+#include <lib/subghz/protocols/base.h>
+#include <lib/subghz/types.h>
+#include <lib/subghz/blocks/const.h>
+#include <lib/subghz/blocks/decoder.h>
+#include <lib/subghz/blocks/encoder.h>
+#include <lib/subghz/blocks/generic.h>
+#include <lib/subghz/blocks/math.h>
+#include <flipper_format/flipper_format.h>
+#include <lib/toolbox/manchester_decoder.h>
+
+// Table-driven decoder for simple OOK remotes.
+//
+// A protocol is a const PirateProto2PwmDescriptor: timings, preamble and
+// sync shape, line coding, bit count and where serial/button/counter sit
+// in the frame. One engine runs every descriptor, a protocol file only
+// holds its table and a PIRATEPROTO2_PWM_PROTOCOL() line.
+
+typedef enum {
+    // Framing not confirmed from real captures yet, the decoder never starts a
+    // frame and only loads saved keys
+    PirateProto2PwmCodingNone,
+    // Bit is carried by the high pulse: te_long high = 1, te_short high = 0
+    PirateProto2PwmCodingPwm,
+    // High is always te_short, bit is carried by the low: te_long low = 1
+    PirateProto2PwmCodingPpm,
+    // te_short is half a bit, te_long a full one
+    PirateProto2PwmCodingManchester,
+} PirateProto2PwmCoding;
+
+// Bit range in the frame, counted from the first received bit, length 0 = absent
+typedef struct {
+    uint8_t start;
+    uint8_t length;
+} PirateProto2PwmField;
+
+typedef struct {
+    const SubGhzProtocol* protocol;
+    SubGhzBlockConst timing;
+    // Short high/low pairs required before the sync, 0 = no preamble
+    uint16_t preamble_count;
+    // Sync pulse that opens the data, always required
+    uint16_t sync_high;
+    uint16_t sync_low;
+    PirateProto2PwmCoding coding;
+    // Swap the meaning of te_short and te_long
+    bool invert;
+    // A low at least this long closes the frame
+    uint16_t gap;
+    PirateProto2PwmField serial;
+    PirateProto2PwmField btn;
+    PirateProto2PwmField cnt;
+} PirateProto2PwmDescriptor;
+
+typedef struct SubGhzProtocolDecoderPwm SubGhzProtocolDecoderPwm;
+
+void* subghz_protocol_decoder_pwm_alloc(const PirateProto2PwmDescriptor* descriptor);
+void subghz_protocol_decoder_pwm_free(void* context);
+void subghz_protocol_decoder_pwm_reset(void* context);
+void subghz_protocol_decoder_pwm_feed(void* context, bool level, uint32_t duration);
+uint8_t subghz_protocol_decoder_pwm_get_hash_data(void* context);
+SubGhzProtocolStatus subghz_protocol_decoder_pwm_serialize(
+    void* context,
+    FlipperFormat* flipper_format,
+    SubGhzRadioPreset* preset);
+SubGhzProtocolStatus
+    subghz_protocol_decoder_pwm_deserialize(void* context, FlipperFormat* flipper_format);
+void subghz_protocol_decoder_pwm_get_string(void* context, FuriString* output);
+
+// Decode only, these protocols can't be sent yet
+extern const SubGhzProtocolEncoder subghz_protocol_pwm_encoder;
+
+// Defines the decoder table of `protocol` running `descriptor`,
+// the protocol itself then points at protocol##_decoder
+#define PIRATEPROTO2_PWM_PROTOCOL(protocol, descriptor)                         \
+    static void* protocol##_decoder_alloc(SubGhzEnvironment* environment) {     \
+        UNUSED(environment);                                                    \
+        return subghz_protocol_decoder_pwm_alloc(&(descriptor));                \
+    }                                                                           \
+    static const SubGhzProtocolDecoder protocol##_decoder = {                   \
+        .alloc = protocol##_decoder_alloc,                                      \
+        .free = subghz_protocol_decoder_pwm_free,                               \
+        .feed = subghz_protocol_decoder_pwm_feed,                               \
+        .reset = subghz_protocol_decoder_pwm_reset,                             \
+        .get_hash_data = subghz_protocol_decoder_pwm_get_hash_data,             \
+        .serialize = subghz_protocol_decoder_pwm_serialize,                     \
+        .deserialize = subghz_protocol_decoder_pwm_deserialize,                 \
+        .get_string = subghz_protocol_decoder_pwm_get_string,                   \
+    };
@@ -171,6 +171,9 @@ bool pirateproto2_scene_protocol_learner_on_event(void* context, SceneManagerEve
             consumed = true;
             break;
         }
+    } else if(event.type == SceneManagerEventTypeTick) {
+        // Bursts are only buffered by the worker, analyse them here
+        pirateproto2_protocol_learner_process(app->protocol_learner);
     }
 
     return consumed;
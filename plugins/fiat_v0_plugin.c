@@ -0,0 +1,5 @@
+// plugins/fiat_v0_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/fiat_v0.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(fiat_protocol_v0)
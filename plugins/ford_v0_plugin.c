@@ -0,0 +1,5 @@
+// plugins/ford_v0_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/ford_v0.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(ford_protocol_v0)
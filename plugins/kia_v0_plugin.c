@@ -0,0 +1,5 @@
+// plugins/kia_v0_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/kia_v0.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(kia_protocol_v0)
@@ -0,0 +1,5 @@
+// plugins/kia_v2_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/kia_v2.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(kia_protocol_v2)
@@ -0,0 +1,5 @@
+// plugins/kia_v5_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/kia_v5.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(kia_protocol_v5)
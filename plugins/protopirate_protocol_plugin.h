@@ -0,0 +1,36 @@
+// plugins/protopirate_protocol_plugin.h
+#pragma once
+
+#include <flipper_application/flipper_application.h>
+#include <lib/subghz/types.h>
+#include <lib/subghz/blocks/const.h>
+#include <storage/storage.h>
+
+#define PROTOPIRATE_PLUGIN_APP_ID      "proto_pirate_protocol"
+#define PROTOPIRATE_PLUGIN_API_VERSION 2
+#define PROTOPIRATE_PLUGIN_PATH        APP_DATA_PATH("plugins")
+
+/** What a protocol plugin's entry_point points to */
+typedef struct {
+    const SubGhzProtocol* protocol;
+    // Checked against the manifest on load
+    const SubGhzBlockConst* timing;
+} ProtoPirateProtocolPlugin;
+
+/**
+ * Defines the entry point of a protocol plugin for protocol and its
+ * protocol##_const timing.
+ */
+#define PROTOPIRATE_PROTOCOL_PLUGIN(protocol)                                    \
+    static const ProtoPirateProtocolPlugin protopirate_protocol_plugin_entry = { \
+        .protocol = &protocol,                                                   \
+        .timing = &protocol##_const,                                             \
+    };                                                                           \
+    static const FlipperAppPluginDescriptor protopirate_protocol_plugin = {      \
+        .appid = PROTOPIRATE_PLUGIN_APP_ID,                                      \
+        .ep_api_version = PROTOPIRATE_PLUGIN_API_VERSION,                        \
+        .entry_point = &protopirate_protocol_plugin_entry,                       \
+    };                                                                           \
+    const FlipperAppPluginDescriptor* protopirate_protocol_plugin_ep(void) {     \
+        return &protopirate_protocol_plugin;                                     \
+    }
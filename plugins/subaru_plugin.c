@@ -0,0 +1,5 @@
+// plugins/subaru_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/subaru.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(subaru_protocol)
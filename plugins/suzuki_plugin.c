@@ -0,0 +1,5 @@
+// plugins/suzuki_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/suzuki.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(suzuki_protocol)
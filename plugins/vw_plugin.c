@@ -0,0 +1,5 @@
+// plugins/vw_plugin.c
+#include "protopirate_protocol_plugin.h"
+#include "../protocols/vw.h"
+
+PROTOPIRATE_PROTOCOL_PLUGIN(vw_protocol)
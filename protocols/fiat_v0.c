@@ -1,9 +1,12 @@
 #include "fiat_v0.h"
 #include <lib/toolbox/manchester_decoder.h>
+#include "protocol_stats.h"
+
+#include <inttypes.h>
 
 #define TAG "FiatProtocolV0"
 
-static const SubGhzBlockConst subghz_protocol_fiat_v0_const = {
+const SubGhzBlockConst fiat_protocol_v0_const = {
     .te_short = 200,
     .te_long = 400,
     .te_delta = 100,
@@ -14,6 +17,7 @@ struct SubGhzProtocolDecoderFiatV0 {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
     ManchesterState manchester_state;
     uint8_t decoder_state;
     uint16_t preamble_count;
@@ -26,6 +30,7 @@ struct SubGhzProtocolDecoderFiatV0 {
     uint8_t final_count;
     uint32_t te_last;
 };
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderFiatV0);
 
 struct SubGhzProtocolEncoderFiatV0 {
     SubGhzProtocolEncoderBase base;
@@ -133,7 +138,7 @@ SubGhzProtocolStatus subghz_protocol_encoder_fiat_v0_deserialize(void *context,
 
         // Parse hex key
         uint64_t key = 0;
-        if (sscanf(furi_string_get_cstr(temp_str), "%016llX", &key) != 1)
+        if (sscanf(furi_string_get_cstr(temp_str), "%016" SCNx64, &key) != 1)
         {
             FURI_LOG_E(TAG, "Failed to parse Key");
             furi_string_free(temp_str);
@@ -192,13 +197,13 @@ LevelDuration subghz_protocol_encoder_fiat_v0_yield(void *context)
         if (is_high)
         {
             is_high = false;
-            return level_duration_make(true, subghz_protocol_fiat_v0_const.te_short);
+            return level_duration_make(true, fiat_protocol_v0_const.te_short);
         }
         else
         {
             is_high = true;
             preamble_count++;
-            return level_duration_make(false, subghz_protocol_fiat_v0_const.te_short);
+            return level_duration_make(false, fiat_protocol_v0_const.te_short);
         }
     }
 
@@ -226,7 +231,7 @@ LevelDuration subghz_protocol_encoder_fiat_v0_yield(void *context)
         {
             is_high = false;
             // Manchester encoding: 1 = short high, 0 = long high
-            uint32_t duration = current_bit ? subghz_protocol_fiat_v0_const.te_short : subghz_protocol_fiat_v0_const.te_long;
+            uint32_t duration = current_bit ? fiat_protocol_v0_const.te_short : fiat_protocol_v0_const.te_long;
             return level_duration_make(true, duration);
         }
         else
@@ -234,7 +239,7 @@ LevelDuration subghz_protocol_encoder_fiat_v0_yield(void *context)
             is_high = true;
             bit_index++;
             // LOW pulse duration matches the previous HIGH duration
-            uint32_t duration = current_bit ? subghz_protocol_fiat_v0_const.te_short : subghz_protocol_fiat_v0_const.te_long;
+            uint32_t duration = current_bit ? fiat_protocol_v0_const.te_short : fiat_protocol_v0_const.te_long;
             
             if (bit_index >= instance->generic.data_count_bit)
             {
@@ -301,9 +306,10 @@ void subghz_protocol_decoder_fiat_v0_reset(void* context) {
 void subghz_protocol_decoder_fiat_v0_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderFiatV0* instance = context;
-    uint32_t te_short = (uint32_t)subghz_protocol_fiat_v0_const.te_short;
-    uint32_t te_long = (uint32_t)subghz_protocol_fiat_v0_const.te_long;
-    uint32_t te_delta = (uint32_t)subghz_protocol_fiat_v0_const.te_delta;
+    instance->stats.pulses++;
+    uint32_t te_short = (uint32_t)fiat_protocol_v0_const.te_short;
+    uint32_t te_long = (uint32_t)fiat_protocol_v0_const.te_long;
+    uint32_t te_delta = (uint32_t)fiat_protocol_v0_const.te_delta;
     uint32_t gap_threshold = 800;
     uint32_t diff;
     switch(instance->decoder_state) {
@@ -319,6 +325,7 @@ void subghz_protocol_decoder_fiat_v0_feed(void* context, bool level, uint32_t du
         if(diff < te_delta) {
             instance->data_low = 0;
             instance->data_high = 0;
+            instance->stats.preamble_starts++;
             instance->decoder_state = FiatV0DecoderStepPreamble;
             instance->te_last = duration;
             instance->preamble_count = 0;
@@ -399,6 +406,10 @@ void subghz_protocol_decoder_fiat_v0_feed(void* context, bool level, uint32_t du
                 }
             }
         }
+        // Every way into the data returns above
+        if(instance->decoder_state == FiatV0DecoderStepReset) {
+            instance->stats.preamble_aborts++;
+        }
         break;
     case FiatV0DecoderStepData:
         ManchesterEvent event = ManchesterEventReset;
@@ -457,6 +468,7 @@ void subghz_protocol_decoder_fiat_v0_feed(void* context, bool level, uint32_t du
                         instance->endbyte; // still exported as btn for UI compatibility
                     instance->generic.cnt = instance->hop;
 
+                    instance->stats.frames++;
                     if(instance->base.callback) {
                         instance->base.callback(&instance->base, instance->base.context);
                     }
@@ -496,7 +508,7 @@ SubGhzProtocolStatus
     furi_assert(context);
     SubGhzProtocolDecoderFiatV0* instance = context;
     return subghz_block_generic_deserialize_check_count_bit(
-        &instance->generic, flipper_format, subghz_protocol_fiat_v0_const.min_count_bit_for_found);
+        &instance->generic, flipper_format, fiat_protocol_v0_const.min_count_bit_for_found);
 }
 
 void subghz_protocol_decoder_fiat_v0_get_string(void* context, FuriString* output) {
@@ -509,8 +521,8 @@ void subghz_protocol_decoder_fiat_v0_get_string(void* context, FuriString* outpu
     furi_string_cat_printf(
         output,
         "%s %dbit\r\n"
-        "Key:%08lX%08lX\r\n"
-        "Hop:%08lX Fix:%08lX\r\n"
+        "Key:%08" PRIX32 "%08" PRIX32 "\r\n"
+        "Hop:%08" PRIX32 " Fix:%08" PRIX32 "\r\n"
         "EndByte:%02X\r\n",
         instance->generic.protocol_name,
         instance->generic.data_count_bit,
@@ -13,8 +13,10 @@
 #define FIAT_PROTOCOL_V0_NAME "Fiat V0"
 
 typedef struct SubGhzProtocolDecoderFiatV0 SubGhzProtocolDecoderFiatV0;
+typedef struct SubGhzProtocolEncoderFiatV0 SubGhzProtocolEncoderFiatV0;
 
 extern const SubGhzProtocol fiat_protocol_v0;
+extern const SubGhzBlockConst fiat_protocol_v0_const;
 
 void* subghz_protocol_decoder_fiat_v0_alloc(SubGhzEnvironment* environment);
 void subghz_protocol_decoder_fiat_v0_free(void* context);
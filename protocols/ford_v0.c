@@ -1,8 +1,11 @@
 #include "ford_v0.h"
+#include "protocol_stats.h"
+
+#include <inttypes.h>
 
 #define TAG "FordProtocolV0"
 
-static const SubGhzBlockConst subghz_protocol_ford_v0_const = {
+const SubGhzBlockConst ford_protocol_v0_const = {
     .te_short = 250,
     .te_long = 500,
     .te_delta = 100,
@@ -14,6 +17,7 @@ typedef struct SubGhzProtocolDecoderFordV0
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
 
     ManchesterState manchester_state;
 
@@ -29,6 +33,7 @@ typedef struct SubGhzProtocolDecoderFordV0
     uint8_t button;
     uint32_t count;
 } SubGhzProtocolDecoderFordV0;
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderFordV0);
 
 typedef struct SubGhzProtocolEncoderFordV0
 {
@@ -130,7 +135,7 @@ SubGhzProtocolStatus subghz_protocol_encoder_ford_v0_deserialize(void *context,
 
         // Parse hex key
         uint64_t key = 0;
-        if (sscanf(furi_string_get_cstr(temp_str), "%016llX", &key) != 1)
+        if (sscanf(furi_string_get_cstr(temp_str), "%016" SCNx64, &key) != 1)
         {
             FURI_LOG_E(TAG, "Failed to parse Key");
             furi_string_free(temp_str);
@@ -181,13 +186,13 @@ LevelDuration subghz_protocol_encoder_ford_v0_yield(void *context)
         if (is_high)
         {
             is_high = false;
-            return level_duration_make(true, subghz_protocol_ford_v0_const.te_short);
+            return level_duration_make(true, ford_protocol_v0_const.te_short);
         }
         else
         {
             is_high = true;
             preamble_count++;
-            return level_duration_make(false, subghz_protocol_ford_v0_const.te_short);
+            return level_duration_make(false, ford_protocol_v0_const.te_short);
         }
     }
 
@@ -195,7 +200,7 @@ LevelDuration subghz_protocol_encoder_ford_v0_yield(void *context)
     if (preamble_count == 16)
     {
         preamble_count++;
-        return level_duration_make(true, subghz_protocol_ford_v0_const.te_long);
+        return level_duration_make(true, ford_protocol_v0_const.te_long);
     }
 
     if (preamble_count == 17)
@@ -203,7 +208,7 @@ LevelDuration subghz_protocol_encoder_ford_v0_yield(void *context)
         preamble_count++;
         bit_index = 0;
         is_high = true;
-        return level_duration_make(false, subghz_protocol_ford_v0_const.te_long);
+        return level_duration_make(false, ford_protocol_v0_const.te_long);
     }
 
     // Send data bits (Manchester encoding)
@@ -215,14 +220,14 @@ LevelDuration subghz_protocol_encoder_ford_v0_yield(void *context)
         {
             is_high = false;
             // Manchester: 0 = short high then long low, 1 = long high then short low
-            uint32_t duration = current_bit ? subghz_protocol_ford_v0_const.te_long : subghz_protocol_ford_v0_const.te_short;
+            uint32_t duration = current_bit ? ford_protocol_v0_const.te_long : ford_protocol_v0_const.te_short;
             return level_duration_make(true, duration);
         }
         else
         {
             is_high = true;
             bit_index++;
-            uint32_t duration = current_bit ? subghz_protocol_ford_v0_const.te_short : subghz_protocol_ford_v0_const.te_long;
+            uint32_t duration = current_bit ? ford_protocol_v0_const.te_short : ford_protocol_v0_const.te_long;
             
             if (bit_index >= instance->generic.data_count_bit)
             {
@@ -394,10 +399,11 @@ void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t du
 {
     furi_assert(context);
     SubGhzProtocolDecoderFordV0 *instance = context;
+    instance->stats.pulses++;
 
-    uint32_t te_short = subghz_protocol_ford_v0_const.te_short;
-    uint32_t te_long = subghz_protocol_ford_v0_const.te_long;
-    uint32_t te_delta = subghz_protocol_ford_v0_const.te_delta;
+    uint32_t te_short = ford_protocol_v0_const.te_short;
+    uint32_t te_long = ford_protocol_v0_const.te_long;
+    uint32_t te_delta = ford_protocol_v0_const.te_delta;
     uint32_t gap_threshold = 3500;
 
     switch (instance->decoder.parser_step)
@@ -407,6 +413,7 @@ void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t du
         {
             instance->data_low = 0;
             instance->data_high = 0;
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = FordV0DecoderStepPreamble;
             instance->decoder.te_last = duration;
             instance->header_count = 0;
@@ -425,6 +432,7 @@ void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t du
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = FordV0DecoderStepReset;
             }
         }
@@ -445,6 +453,7 @@ void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t du
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = FordV0DecoderStepReset;
             }
         }
@@ -460,6 +469,7 @@ void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t du
         }
         else if (!level && duration > gap_threshold + 250)
         {
+            instance->stats.preamble_aborts++;
             instance->decoder.parser_step = FordV0DecoderStepReset;
         }
         break;
@@ -478,6 +488,8 @@ void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t du
         }
         else
         {
+            // Frame cut short, the 64 + 16 bits never completed
+            instance->stats.bit_mismatches++;
             instance->decoder.parser_step = FordV0DecoderStepReset;
             break;
         }
@@ -495,6 +507,7 @@ void subghz_protocol_decoder_ford_v0_feed(void *context, bool level, uint32_t du
                 instance->generic.btn = instance->button;
                 instance->generic.cnt = instance->count;
 
+                instance->stats.frames++;
                 if (instance->base.callback)
                 {
                     instance->base.callback(&instance->base, instance->base.context);
@@ -559,7 +572,7 @@ SubGhzProtocolStatus subghz_protocol_decoder_ford_v0_deserialize(void *context,
     furi_assert(context);
     SubGhzProtocolDecoderFordV0 *instance = context;
     return subghz_block_generic_deserialize_check_count_bit(
-        &instance->generic, flipper_format, subghz_protocol_ford_v0_const.min_count_bit_for_found);
+        &instance->generic, flipper_format, ford_protocol_v0_const.min_count_bit_for_found);
 }
 
 void subghz_protocol_decoder_ford_v0_get_string(void *context, FuriString *output)
@@ -573,8 +586,8 @@ void subghz_protocol_decoder_ford_v0_get_string(void *context, FuriString *outpu
     furi_string_cat_printf(
         output,
         "%s %dbit\r\n"
-        "Key:%08lX%08lX\r\n"
-        "Sn:%08lX Btn:%02X Cnt:%06lX\r\n"
+        "Key:%08" PRIX32 "%08" PRIX32 "\r\n"
+        "Sn:%08" PRIX32 " Btn:%02X Cnt:%06" PRIX32 "\r\n"
         "BS:%02X CRC:%02X\r\n",
         instance->generic.protocol_name,
         instance->generic.data_count_bit,
@@ -14,6 +14,7 @@
 #define FORD_PROTOCOL_V0_NAME "Ford V0"
 
 extern const SubGhzProtocol ford_protocol_v0;
+extern const SubGhzBlockConst ford_protocol_v0_const;
 
 void* subghz_protocol_decoder_ford_v0_alloc(SubGhzEnvironment* environment);
 void subghz_protocol_decoder_ford_v0_free(void* context);
@@ -1,21 +1,41 @@
 #include "kia_v0.h"
+#include "protocol_fields.h"
+#include "protocol_stats.h"
+#include "protocol_timing.h"
+
+#include <inttypes.h>
 
 #define TAG "KiaProtocolV0"
 
-static const SubGhzBlockConst subghz_protocol_kia_const = {
+const SubGhzBlockConst kia_protocol_v0_const = {
     .te_short = 250,
     .te_long = 500,
     .te_delta = 100,
     .min_count_bit_for_found = 61,
 };
 
+static const ProtoPirateField subghz_protocol_kia_field_list[] = {
+    {.key = "Serial", .label = "Sn", .source = ProtoPirateFieldBits, .shift = 12, .width = 28, .digits = 7},
+    {.key = "Btn", .label = "Btn", .source = ProtoPirateFieldBits, .shift = 8, .width = 4},
+    {.key = "Cnt", .label = "Cnt", .source = ProtoPirateFieldBits, .shift = 40, .width = 16, .digits = 4},
+};
+
+static const ProtoPirateFieldMap subghz_protocol_kia_fields = {
+    .key_digits = 16,
+    .fields = subghz_protocol_kia_field_list,
+    .field_count = COUNT_OF(subghz_protocol_kia_field_list),
+};
+
 struct SubGhzProtocolDecoderKIA
 {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
     uint16_t header_count;
+    ProtoPirateTiming timing;
 };
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderKIA);
 
 struct SubGhzProtocolEncoderKIA
 {
@@ -146,7 +166,7 @@ SubGhzProtocolStatus subghz_protocol_encoder_kia_deserialize(void *context, Flip
 
         // Parse hex key
         uint64_t key = 0;
-        if (sscanf(furi_string_get_cstr(temp_str), "%016llX", &key) != 1)
+        if (sscanf(furi_string_get_cstr(temp_str), "%016" SCNx64, &key) != 1)
         {
             FURI_LOG_E(TAG, "Failed to parse Key");
             furi_string_free(temp_str);
@@ -249,13 +269,13 @@ LevelDuration subghz_protocol_encoder_kia_yield(void *context)
         {
             // HIGH pulse
             instance->preamble_count++;
-            return level_duration_make(true, subghz_protocol_kia_const.te_short);
+            return level_duration_make(true, kia_protocol_v0_const.te_short);
         }
         else
         {
             // LOW pulse
             instance->preamble_count++;
-            return level_duration_make(false, subghz_protocol_kia_const.te_short);
+            return level_duration_make(false, kia_protocol_v0_const.te_short);
         }
     }
 
@@ -263,7 +283,7 @@ LevelDuration subghz_protocol_encoder_kia_yield(void *context)
     if (instance->preamble_count == 32)
     {
         instance->preamble_count++;
-        return level_duration_make(true, subghz_protocol_kia_const.te_long);
+        return level_duration_make(true, kia_protocol_v0_const.te_long);
     }
 
     if (instance->preamble_count == 33)
@@ -272,7 +292,7 @@ LevelDuration subghz_protocol_encoder_kia_yield(void *context)
         // Start data, first bit is always 1
         instance->data_bit_index = 0;
         instance->last_bit = 1;
-        return level_duration_make(false, subghz_protocol_kia_const.te_long);
+        return level_duration_make(false, kia_protocol_v0_const.te_long);
     }
 
     // Send data bits (61 bits total)
@@ -304,7 +324,7 @@ LevelDuration subghz_protocol_encoder_kia_yield(void *context)
             instance->last_bit = current_bit;
 
             // HIGH duration based on bit value
-            uint32_t duration = current_bit ? subghz_protocol_kia_const.te_long : subghz_protocol_kia_const.te_short;
+            uint32_t duration = current_bit ? kia_protocol_v0_const.te_long : kia_protocol_v0_const.te_short;
 
             return level_duration_make(true, duration);
         }
@@ -315,7 +335,7 @@ LevelDuration subghz_protocol_encoder_kia_yield(void *context)
             instance->data_bit_index++;
 
             // LOW duration matches HIGH duration
-            uint32_t duration = instance->last_bit ? subghz_protocol_kia_const.te_long : subghz_protocol_kia_const.te_short;
+            uint32_t duration = instance->last_bit ? kia_protocol_v0_const.te_long : kia_protocol_v0_const.te_short;
 
             // Check if we're done
             if (instance->data_bit_index >= instance->generic.data_count_bit)
@@ -373,43 +393,49 @@ void subghz_protocol_decoder_kia_feed(void *context, bool level, uint32_t durati
 {
     furi_assert(context);
     SubGhzProtocolDecoderKIA *instance = context;
+    instance->stats.pulses++;
 
     switch (instance->decoder.parser_step)
     {
     case KIADecoderStepReset:
-        if ((level) && (DURATION_DIFF(duration, subghz_protocol_kia_const.te_short) < subghz_protocol_kia_const.te_delta))
+        if ((level) && (DURATION_DIFF(duration, kia_protocol_v0_const.te_short) < kia_protocol_v0_const.te_delta))
         {
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = KIADecoderStepCheckPreambula;
             instance->decoder.te_last = duration;
             instance->header_count = 0;
+            protopirate_timing_reset(&instance->timing);
         }
         break;
     case KIADecoderStepCheckPreambula:
         if (level)
         {
-            if ((DURATION_DIFF(duration, subghz_protocol_kia_const.te_short) < subghz_protocol_kia_const.te_delta) ||
-                (DURATION_DIFF(duration, subghz_protocol_kia_const.te_long) < subghz_protocol_kia_const.te_delta))
+            if ((DURATION_DIFF(duration, kia_protocol_v0_const.te_short) < kia_protocol_v0_const.te_delta) ||
+                (DURATION_DIFF(duration, kia_protocol_v0_const.te_long) < kia_protocol_v0_const.te_delta))
             {
                 instance->decoder.te_last = duration;
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KIADecoderStepReset;
             }
         }
         else if (
-            (DURATION_DIFF(duration, subghz_protocol_kia_const.te_short) < subghz_protocol_kia_const.te_delta) &&
-            (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_kia_const.te_short) < subghz_protocol_kia_const.te_delta))
+            (DURATION_DIFF(duration, kia_protocol_v0_const.te_short) < kia_protocol_v0_const.te_delta) &&
+            (DURATION_DIFF(instance->decoder.te_last, kia_protocol_v0_const.te_short) < kia_protocol_v0_const.te_delta))
         {
             instance->header_count++;
+            protopirate_timing_add(&instance->timing, instance->decoder.te_last + duration, 2);
             break;
         }
         else if (
-            (DURATION_DIFF(duration, subghz_protocol_kia_const.te_long) < subghz_protocol_kia_const.te_delta) &&
-            (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_kia_const.te_long) < subghz_protocol_kia_const.te_delta))
+            (DURATION_DIFF(duration, kia_protocol_v0_const.te_long) < kia_protocol_v0_const.te_delta) &&
+            (DURATION_DIFF(instance->decoder.te_last, kia_protocol_v0_const.te_long) < kia_protocol_v0_const.te_delta))
         {
             if (instance->header_count > 15)
             {
+                protopirate_timing_lock(&instance->timing, &kia_protocol_v0_const);
                 instance->decoder.parser_step = KIADecoderStepSaveDuration;
                 instance->decoder.decode_data = 0;
                 instance->decoder.decode_count_bit = 1;
@@ -417,11 +443,13 @@ void subghz_protocol_decoder_kia_feed(void *context, bool level, uint32_t durati
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KIADecoderStepReset;
             }
         }
         else
         {
+            instance->stats.preamble_aborts++;
             instance->decoder.parser_step = KIADecoderStepReset;
         }
         break;
@@ -429,17 +457,23 @@ void subghz_protocol_decoder_kia_feed(void *context, bool level, uint32_t durati
         if (level)
         {
             if (duration >=
-                (subghz_protocol_kia_const.te_long + subghz_protocol_kia_const.te_delta * 2UL))
+                (kia_protocol_v0_const.te_long + kia_protocol_v0_const.te_delta * 2UL))
             {
                 instance->decoder.parser_step = KIADecoderStepReset;
                 if (instance->decoder.decode_count_bit ==
-                    subghz_protocol_kia_const.min_count_bit_for_found)
+                    kia_protocol_v0_const.min_count_bit_for_found)
                 {
                     instance->generic.data = instance->decoder.decode_data;
                     instance->generic.data_count_bit = instance->decoder.decode_count_bit;
+                    protopirate_timing_get_quality(&instance->timing, &instance->stats.quality);
+                    instance->stats.frames++;
                     if (instance->base.callback)
                         instance->base.callback(&instance->base, instance->base.context);
                 }
+                else
+                {
+                    instance->stats.bit_mismatches++;
+                }
                 instance->decoder.decode_data = 0;
                 instance->decoder.decode_count_bit = 0;
                 break;
@@ -458,16 +492,22 @@ void subghz_protocol_decoder_kia_feed(void *context, bool level, uint32_t durati
     case KIADecoderStepCheckDuration:
         if (!level)
         {
-            if ((DURATION_DIFF(instance->decoder.te_last, subghz_protocol_kia_const.te_short) < subghz_protocol_kia_const.te_delta) &&
-                (DURATION_DIFF(duration, subghz_protocol_kia_const.te_short) < subghz_protocol_kia_const.te_delta))
+            // Around the period recovered from this frame's preamble
+            uint8_t bit = instance->decoder.decode_count_bit;
+            if (protopirate_timing_match(&instance->timing, instance->decoder.te_last, 1) &&
+                protopirate_timing_match(&instance->timing, duration, 1))
             {
+                protopirate_timing_grade(&instance->timing, instance->decoder.te_last, 1, bit);
+                protopirate_timing_grade(&instance->timing, duration, 1, bit);
                 subghz_protocol_blocks_add_bit(&instance->decoder, 0);
                 instance->decoder.parser_step = KIADecoderStepSaveDuration;
             }
             else if (
-                (DURATION_DIFF(instance->decoder.te_last, subghz_protocol_kia_const.te_long) < subghz_protocol_kia_const.te_delta) &&
-                (DURATION_DIFF(duration, subghz_protocol_kia_const.te_long) < subghz_protocol_kia_const.te_delta))
+                protopirate_timing_match(&instance->timing, instance->decoder.te_last, 2) &&
+                protopirate_timing_match(&instance->timing, duration, 2))
             {
+                protopirate_timing_grade(&instance->timing, instance->decoder.te_last, 2, bit);
+                protopirate_timing_grade(&instance->timing, duration, 2, bit);
                 subghz_protocol_blocks_add_bit(&instance->decoder, 1);
                 instance->decoder.parser_step = KIADecoderStepSaveDuration;
             }
@@ -484,13 +524,6 @@ void subghz_protocol_decoder_kia_feed(void *context, bool level, uint32_t durati
     }
 }
 
-static void subghz_protocol_kia_check_remote_controller(SubGhzBlockGeneric *instance)
-{
-    instance->serial = (uint32_t)((instance->data >> 12) & 0x0FFFFFFF);
-    instance->btn = (instance->data >> 8) & 0x0F;
-    instance->cnt = (instance->data >> 40) & 0xFFFF;
-}
-
 uint8_t subghz_protocol_decoder_kia_get_hash_data(void *context)
 {
     furi_assert(context);
@@ -506,26 +539,8 @@ SubGhzProtocolStatus subghz_protocol_decoder_kia_serialize(
 {
     furi_assert(context);
     SubGhzProtocolDecoderKIA *instance = context;
-
-    SubGhzProtocolStatus ret = SubGhzProtocolStatusError;
-
-    ret = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
-
-    if (ret == SubGhzProtocolStatusOk)
-    {
-        // Ensure fields are extracted
-        subghz_protocol_kia_check_remote_controller(&instance->generic);
-
-        // Save decoded fields
-        flipper_format_write_uint32(flipper_format, "Serial", &instance->generic.serial, 1);
-
-        uint32_t temp = instance->generic.btn;
-        flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
-
-        flipper_format_write_uint32(flipper_format, "Cnt", &instance->generic.cnt, 1);
-    }
-
-    return ret;
+    return protopirate_fields_serialize(
+        &subghz_protocol_kia_fields, &instance->generic, flipper_format, preset);
 }
 
 SubGhzProtocolStatus
@@ -534,28 +549,12 @@ subghz_protocol_decoder_kia_deserialize(void *context, FlipperFormat *flipper_fo
     furi_assert(context);
     SubGhzProtocolDecoderKIA *instance = context;
     return subghz_block_generic_deserialize_check_count_bit(
-        &instance->generic, flipper_format, subghz_protocol_kia_const.min_count_bit_for_found);
+        &instance->generic, flipper_format, kia_protocol_v0_const.min_count_bit_for_found);
 }
 
 void subghz_protocol_decoder_kia_get_string(void *context, FuriString *output)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKIA *instance = context;
-
-    subghz_protocol_kia_check_remote_controller(&instance->generic);
-    uint32_t code_found_hi = instance->generic.data >> 32;
-    uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
-
-    furi_string_cat_printf(
-        output,
-        "%s %dbit\r\n"
-        "Key:%08lX%08lX\r\n"
-        "Sn:%07lX Btn:%X Cnt:%04lX\r\n",
-        instance->generic.protocol_name,
-        instance->generic.data_count_bit,
-        code_found_hi,
-        code_found_lo,
-        instance->generic.serial,
-        instance->generic.btn,
-        instance->generic.cnt);
-}
\ No newline at end of file
+    protopirate_fields_get_string(&subghz_protocol_kia_fields, &instance->generic, output);
+}
@@ -1,25 +1,44 @@
 #include "kia_v1.h"
+#include "protocol_fields.h"
+#include "protocol_stats.h"
+#include "protocol_trace.h"
 
 #define TAG "KiaV1"
 
 // OOK PCM 800µs timing
-static const SubGhzBlockConst kia_protocol_v1_const = {
+const SubGhzBlockConst kia_protocol_v1_const = {
     .te_short = 800,
     .te_long = 1600,
     .te_delta = 200,
     .min_count_bit_for_found = 56,
 };
 
+static const ProtoPirateField kia_protocol_v1_field_list[] = {
+    {.key = "Serial", .label = "Sn", .source = ProtoPirateFieldBits, .shift = 24, .width = 32, .digits = 8},
+    {.key = "Btn", .label = "Btn", .source = ProtoPirateFieldBits, .shift = 16, .width = 8, .digits = 2},
+    {.key = "Cnt", .label = "Cnt", .source = ProtoPirateFieldBits, .shift = 8, .width = 8, .digits = 2, .new_line = true},
+    {.key = "CRC", .label = "CRC", .source = ProtoPirateFieldBits, .width = 8, .digits = 2},
+};
+
+static const ProtoPirateFieldMap kia_protocol_v1_fields = {
+    .key_digits = 14,
+    .fields = kia_protocol_v1_field_list,
+    .field_count = COUNT_OF(kia_protocol_v1_field_list),
+};
+
 struct SubGhzProtocolDecoderKiaV1
 {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
     uint16_t header_count;
 
     uint8_t raw_bits[24];
     uint16_t raw_bit_count;
+    ProtoPirateTraceRing *trace;
 };
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderKiaV1);
 
 struct SubGhzProtocolEncoderKiaV1
 {
@@ -91,21 +110,21 @@ static inline bool kia_v1_get_raw_bit(SubGhzProtocolDecoderKiaV1 *instance, uint
 
 static bool kia_v1_manchester_decode(SubGhzProtocolDecoderKiaV1 *instance)
 {
+    // The End trace before this already carries the short count
     if (instance->raw_bit_count < 113)
     {
-        FURI_LOG_D(TAG, "Not enough raw bits: %u", instance->raw_bit_count);
         return false;
     }
 
-    FURI_LOG_D(
-        TAG,
-        "Raw: %02X %02X %02X %02X %02X %02X",
-        instance->raw_bits[0],
-        instance->raw_bits[1],
-        instance->raw_bits[2],
-        instance->raw_bits[3],
-        instance->raw_bits[4],
-        instance->raw_bits[5]);
+    PROTOPIRATE_TRACE(
+        KIA_V1,
+        instance->trace,
+        ProtoPirateTraceEventKiaV1Raw,
+        (uint32_t)instance->raw_bits[0] << 24 | (uint32_t)instance->raw_bits[1] << 16 |
+            (uint32_t)instance->raw_bits[2] << 8 | instance->raw_bits[3],
+        (uint32_t)instance->raw_bits[4] << 8 | instance->raw_bits[5],
+        instance->raw_bit_count,
+        0);
 
     // Try different offsets to find best alignment (RTL-433 uses -1 bit offset)
     uint16_t best_bits = 0;
@@ -149,7 +168,14 @@ static bool kia_v1_manchester_decode(SubGhzProtocolDecoderKiaV1 *instance)
         }
     }
 
-    FURI_LOG_I(TAG, "Best: offset=%u bits=%u data=%014llX", best_offset, best_bits, best_data);
+    PROTOPIRATE_TRACE(
+        KIA_V1,
+        instance->trace,
+        ProtoPirateTraceEventKiaV1Best,
+        best_offset,
+        best_bits,
+        (uint32_t)(best_data >> 32),
+        (uint32_t)best_data);
 
     instance->decoder.decode_data = best_data;
     instance->decoder.decode_count_bit = best_bits;
@@ -163,6 +189,7 @@ void *kia_protocol_decoder_v1_alloc(SubGhzEnvironment *environment)
     SubGhzProtocolDecoderKiaV1 *instance = malloc(sizeof(SubGhzProtocolDecoderKiaV1));
     instance->base.protocol = &kia_protocol_v1;
     instance->generic.protocol_name = instance->base.protocol->name;
+    instance->trace = PROTOPIRATE_TRACE_KIA_V1 ? protopirate_trace_open() : NULL;
     return instance;
 }
 
@@ -170,6 +197,7 @@ void kia_protocol_decoder_v1_free(void *context)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV1 *instance = context;
+    protopirate_trace_close(instance->trace);
     free(instance);
 }
 
@@ -187,6 +215,7 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV1 *instance = context;
+    instance->stats.pulses++;
 
     switch (instance->decoder.parser_step)
     {
@@ -195,6 +224,7 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
         if ((level) && (DURATION_DIFF(duration, kia_protocol_v1_const.te_long) <
                         kia_protocol_v1_const.te_delta))
         {
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = KiaV1DecoderStepCheckPreamble;
             instance->decoder.te_last = duration;
             instance->header_count = 1;
@@ -218,6 +248,7 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV1DecoderStepReset;
             }
         }
@@ -241,6 +272,7 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV1DecoderStepReset;
             }
         }
@@ -251,7 +283,14 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
         if (level && (DURATION_DIFF(duration, kia_protocol_v1_const.te_short) <
                       kia_protocol_v1_const.te_delta))
         {
-            FURI_LOG_I(TAG, "Sync! hdr=%u", instance->header_count);
+            PROTOPIRATE_TRACE(
+                KIA_V1,
+                instance->trace,
+                ProtoPirateTraceEventKiaV1Sync,
+                instance->header_count,
+                0,
+                0,
+                0);
             instance->decoder.parser_step = KiaV1DecoderStepCollectRawBits;
             instance->raw_bit_count = 0;
             memset(instance->raw_bits, 0, sizeof(instance->raw_bits));
@@ -260,6 +299,7 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
         }
         else
         {
+            instance->stats.preamble_aborts++;
             instance->decoder.parser_step = KiaV1DecoderStepReset;
         }
         break;
@@ -267,7 +307,14 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
     case KiaV1DecoderStepCollectRawBits:
         if (duration > 2400)
         {
-            FURI_LOG_I(TAG, "End! raw_bits=%u", instance->raw_bit_count);
+            PROTOPIRATE_TRACE(
+                KIA_V1,
+                instance->trace,
+                ProtoPirateTraceEventKiaV1End,
+                instance->raw_bit_count,
+                0,
+                0,
+                0);
 
             if (kia_v1_manchester_decode(instance))
             {
@@ -283,17 +330,23 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
                 instance->generic.btn = (uint8_t)((instance->generic.data >> 16) & 0xFF);
                 instance->generic.cnt = (uint8_t)((instance->generic.data >> 8) & 0xFF);
 
-                FURI_LOG_I(
-                    TAG,
-                    "DECODE! Key=%014llX Sn=%08lX Btn=%02X Cnt=%02X",
-                    instance->generic.data,
+                PROTOPIRATE_TRACE(
+                    KIA_V1,
+                    instance->trace,
+                    ProtoPirateTraceEventKiaV1Decode,
+                    (uint32_t)(instance->generic.data >> 32),
+                    (uint32_t)instance->generic.data,
                     instance->generic.serial,
-                    instance->generic.btn,
-                    (uint8_t)instance->generic.cnt);
+                    (uint32_t)instance->generic.btn << 8 | (uint8_t)instance->generic.cnt);
 
+                instance->stats.frames++;
                 if (instance->base.callback)
                     instance->base.callback(&instance->base, instance->base.context);
             }
+            else
+            {
+                instance->stats.bit_mismatches++;
+            }
 
             instance->decoder.parser_step = KiaV1DecoderStepReset;
             break;
@@ -313,12 +366,14 @@ void kia_protocol_decoder_v1_feed(void *context, bool level, uint32_t duration)
         }
         else
         {
-            FURI_LOG_D(
-                TAG,
-                "Invalid pulse: %s %lu, raw_bits=%u",
-                level ? "H" : "L",
+            PROTOPIRATE_TRACE(
+                KIA_V1,
+                instance->trace,
+                ProtoPirateTraceEventKiaV1BadPulse,
+                level,
                 duration,
-                instance->raw_bit_count);
+                instance->raw_bit_count,
+                0);
             instance->decoder.parser_step = KiaV1DecoderStepReset;
             break;
         }
@@ -347,28 +402,8 @@ SubGhzProtocolStatus kia_protocol_decoder_v1_serialize(
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV1 *instance = context;
-
-    SubGhzProtocolStatus ret = SubGhzProtocolStatusError;
-
-    ret = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
-
-    if (ret == SubGhzProtocolStatusOk)
-    {
-        // Save CRC (last byte)
-        uint32_t crc = instance->generic.data & 0xFF;
-        flipper_format_write_uint32(flipper_format, "CRC", &crc, 1);
-
-        // Save decoded fields
-        flipper_format_write_uint32(flipper_format, "Serial", &instance->generic.serial, 1);
-
-        uint32_t temp = instance->generic.btn;
-        flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
-
-        temp = instance->generic.cnt;
-        flipper_format_write_uint32(flipper_format, "Cnt", &temp, 1);
-    }
-
-    return ret;
+    return protopirate_fields_serialize(
+        &kia_protocol_v1_fields, &instance->generic, flipper_format, preset);
 }
 
 SubGhzProtocolStatus
@@ -384,20 +419,5 @@ void kia_protocol_decoder_v1_get_string(void *context, FuriString *output)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV1 *instance = context;
-
-    uint8_t crc = instance->generic.data & 0xFF;
-
-    furi_string_cat_printf(
-        output,
-        "%s %dbit\r\n"
-        "Key:%014llX\r\n"
-        "Sn:%08lX Btn:%02X\r\n"
-        "Cnt:%02X CRC:%02X\r\n",
-        instance->generic.protocol_name,
-        instance->generic.data_count_bit,
-        instance->generic.data,
-        instance->generic.serial,
-        instance->generic.btn,
-        (uint8_t)instance->generic.cnt,
-        crc);
+    protopirate_fields_get_string(&kia_protocol_v1_fields, &instance->generic, output);
 }
@@ -10,6 +10,7 @@ typedef struct SubGhzProtocolEncoderKiaV1 SubGhzProtocolEncoderKiaV1;
 extern const SubGhzProtocolDecoder kia_protocol_v1_decoder;
 extern const SubGhzProtocolEncoder kia_protocol_v1_encoder;
 extern const SubGhzProtocol kia_protocol_v1;
+extern const SubGhzBlockConst kia_protocol_v1_const;
 
 void* kia_protocol_decoder_v1_alloc(SubGhzEnvironment* environment);
 void kia_protocol_decoder_v1_free(void* context);
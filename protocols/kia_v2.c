@@ -1,24 +1,42 @@
 #include "kia_v2.h"
+#include "protocol_fields.h"
+#include "protocol_stats.h"
 
 #define TAG "KiaV2"
 
-static const SubGhzBlockConst kia_protocol_v2_const = {
+const SubGhzBlockConst kia_protocol_v2_const = {
     .te_short = 500,
     .te_long = 1000,
     .te_delta = 150,
     .min_count_bit_for_found = 51,
 };
 
+static const ProtoPirateField kia_protocol_v2_field_list[] = {
+    {.key = "Serial", .label = "Sn", .source = ProtoPirateFieldSerial, .width = 32, .digits = 8},
+    {.key = "Btn", .label = "Btn", .source = ProtoPirateFieldBtn, .width = 4},
+    {.key = "Cnt", .label = "Cnt", .source = ProtoPirateFieldCnt, .width = 12, .digits = 3, .new_line = true},
+    {.key = "CRC", .label = "CRC", .source = ProtoPirateFieldBits, .width = 4},
+    {.key = "RawCnt", .source = ProtoPirateFieldBits, .shift = 4, .width = 12},
+};
+
+static const ProtoPirateFieldMap kia_protocol_v2_fields = {
+    .key_digits = 13,
+    .fields = kia_protocol_v2_field_list,
+    .field_count = COUNT_OF(kia_protocol_v2_field_list),
+};
+
 struct SubGhzProtocolDecoderKiaV2
 {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
     uint16_t header_count;
 
     uint8_t raw_bits[20];
     uint16_t raw_bit_count;
 };
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderKiaV2);
 
 struct SubGhzProtocolEncoderKiaV2
 {
@@ -168,6 +186,7 @@ void kia_protocol_decoder_v2_feed(void *context, bool level, uint32_t duration)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV2 *instance = context;
+    instance->stats.pulses++;
 
     switch (instance->decoder.parser_step)
     {
@@ -175,6 +194,7 @@ void kia_protocol_decoder_v2_feed(void *context, bool level, uint32_t duration)
         if ((level) && (DURATION_DIFF(duration, kia_protocol_v2_const.te_long) <
                         kia_protocol_v2_const.te_delta))
         {
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = KiaV2DecoderStepCheckPreamble;
             instance->decoder.te_last = duration;
             instance->header_count = 1;
@@ -198,6 +218,7 @@ void kia_protocol_decoder_v2_feed(void *context, bool level, uint32_t duration)
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV2DecoderStepReset;
             }
         }
@@ -223,6 +244,7 @@ void kia_protocol_decoder_v2_feed(void *context, bool level, uint32_t duration)
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV2DecoderStepReset;
             }
         }
@@ -242,9 +264,14 @@ void kia_protocol_decoder_v2_feed(void *context, bool level, uint32_t duration)
                 uint16_t raw_count = (uint16_t)((instance->generic.data >> 4) & 0xFFF);
                 instance->generic.cnt = ((raw_count >> 4) | (raw_count << 8)) & 0xFFF;
 
+                instance->stats.frames++;
                 if (instance->base.callback)
                     instance->base.callback(&instance->base, instance->base.context);
             }
+            else
+            {
+                instance->stats.bit_mismatches++;
+            }
 
             instance->decoder.parser_step = KiaV2DecoderStepReset;
             break;
@@ -292,31 +319,8 @@ SubGhzProtocolStatus kia_protocol_decoder_v2_serialize(
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV2 *instance = context;
-
-    SubGhzProtocolStatus ret = SubGhzProtocolStatusError;
-
-    ret = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
-
-    if (ret == SubGhzProtocolStatusOk)
-    {
-        // Save CRC (last nibble)
-        uint32_t crc = instance->generic.data & 0x0F;
-        flipper_format_write_uint32(flipper_format, "CRC", &crc, 1);
-
-        // Save decoded fields
-        flipper_format_write_uint32(flipper_format, "Serial", &instance->generic.serial, 1);
-
-        uint32_t temp = instance->generic.btn;
-        flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
-
-        flipper_format_write_uint32(flipper_format, "Cnt", &instance->generic.cnt, 1);
-
-        // Save raw count before transformation (for exact reproduction)
-        uint32_t raw_count = (uint16_t)((instance->generic.data >> 4) & 0xFFF);
-        flipper_format_write_uint32(flipper_format, "RawCnt", &raw_count, 1);
-    }
-
-    return ret;
+    return protopirate_fields_serialize(
+        &kia_protocol_v2_fields, &instance->generic, flipper_format, preset);
 }
 
 SubGhzProtocolStatus
@@ -332,20 +336,5 @@ void kia_protocol_decoder_v2_get_string(void *context, FuriString *output)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV2 *instance = context;
-
-    uint8_t crc = instance->generic.data & 0x0F;
-
-    furi_string_cat_printf(
-        output,
-        "%s %dbit\r\n"
-        "Key:%013llX\r\n"
-        "Sn:%08lX Btn:%X\r\n"
-        "Cnt:%03lX CRC:%X\r\n",
-        instance->generic.protocol_name,
-        instance->generic.data_count_bit,
-        instance->generic.data,
-        instance->generic.serial,
-        instance->generic.btn,
-        instance->generic.cnt,
-        crc);
+    protopirate_fields_get_string(&kia_protocol_v2_fields, &instance->generic, output);
 }
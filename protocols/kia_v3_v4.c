@@ -1,11 +1,14 @@
 #include "kia_v3_v4.h"
+#include "protocol_stats.h"
+
+#include <inttypes.h>
 
 #define TAG "KiaV3V4"
 
 static const uint64_t kia_mf_key = 0xA8F5DFFC8DAA5CDB;
 static const char *kia_version_names[] = {"Kia V4", "Kia V3"};
 
-static const SubGhzBlockConst kia_protocol_v3_v4_const = {
+const SubGhzBlockConst kia_protocol_v3_v4_const = {
     .te_short = 400,
     .te_long = 800,
     .te_delta = 150,
@@ -17,6 +20,7 @@ typedef struct SubGhzProtocolDecoderKiaV3V4
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
     uint16_t header_count;
 
     uint8_t raw_bits[32];
@@ -27,6 +31,7 @@ typedef struct SubGhzProtocolDecoderKiaV3V4
     uint32_t decrypted;
     uint8_t version; // 0 = V4, 1 = V3
 } SubGhzProtocolDecoderKiaV3V4;
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderKiaV3V4);
 
 typedef struct SubGhzProtocolEncoderKiaV3V4
 {
@@ -90,6 +95,7 @@ static bool kia_v3_v4_process_buffer(SubGhzProtocolDecoderKiaV3V4 *instance)
 {
     if (instance->raw_bit_count < 64)
     {
+        instance->stats.bit_mismatches++;
         return false;
     }
 
@@ -123,6 +129,7 @@ static bool kia_v3_v4_process_buffer(SubGhzProtocolDecoderKiaV3V4 *instance)
     // Validate
     if (dec_btn != btn || dec_serial_lsb != our_serial_lsb)
     {
+        instance->stats.checksum_fails++;
         return false;
     }
 
@@ -140,6 +147,7 @@ static bool kia_v3_v4_process_buffer(SubGhzProtocolDecoderKiaV3V4 *instance)
     instance->generic.data = key_data;
     instance->generic.data_count_bit = 64;
 
+    instance->stats.frames++;
     return true;
 }
 
@@ -201,6 +209,7 @@ void kia_protocol_decoder_v3_v4_feed(void *context, bool level, uint32_t duratio
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV3V4 *instance = context;
+    instance->stats.pulses++;
 
     switch (instance->decoder.parser_step)
     {
@@ -208,6 +217,7 @@ void kia_protocol_decoder_v3_v4_feed(void *context, bool level, uint32_t duratio
         if (level && DURATION_DIFF(duration, kia_protocol_v3_v4_const.te_short) <
                          kia_protocol_v3_v4_const.te_delta)
         {
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = KiaV3V4DecoderStepCheckPreamble;
             instance->decoder.te_last = duration;
             instance->header_count = 1;
@@ -234,11 +244,13 @@ void kia_protocol_decoder_v3_v4_feed(void *context, bool level, uint32_t duratio
                 }
                 else
                 {
+                    instance->stats.preamble_aborts++;
                     instance->decoder.parser_step = KiaV3V4DecoderStepReset;
                 }
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV3V4DecoderStepReset;
             }
         }
@@ -256,6 +268,7 @@ void kia_protocol_decoder_v3_v4_feed(void *context, bool level, uint32_t duratio
                 }
                 else
                 {
+                    instance->stats.preamble_aborts++;
                     instance->decoder.parser_step = KiaV3V4DecoderStepReset;
                 }
             }
@@ -269,6 +282,7 @@ void kia_protocol_decoder_v3_v4_feed(void *context, bool level, uint32_t duratio
             }
             else if (duration > 1500)
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV3V4DecoderStepReset;
             }
         }
@@ -380,9 +394,9 @@ void kia_protocol_decoder_v3_v4_get_string(void *context, FuriString *output)
     furi_string_cat_printf(
         output,
         "%s %dbit\r\n"
-        "Key:%016llX\r\n"
-        "Sn:%07lX Btn:%X Cnt:%04lX\r\n"
-        "Enc:%08lX Dec:%08lX\r\n",
+        "Key:%016" PRIX64 "\r\n"
+        "Sn:%07" PRIX32 " Btn:%X Cnt:%04" PRIX32 "\r\n"
+        "Enc:%08" PRIX32 " Dec:%08" PRIX32 "\r\n",
         kia_version_names[instance->version],
         instance->generic.data_count_bit,
         instance->generic.data,
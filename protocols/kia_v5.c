@@ -1,24 +1,44 @@
 #include "kia_v5.h"
+#include "protocol_fields.h"
+#include "protocol_stats.h"
+#include "protocol_trace.h"
 
 #define TAG "KiaV5"
 
-static const SubGhzBlockConst kia_protocol_v5_const = {
+const SubGhzBlockConst kia_protocol_v5_const = {
     .te_short = 400,
     .te_long = 800,
     .te_delta = 150,
     .min_count_bit_for_found = 64,
 };
 
+static const ProtoPirateField kia_protocol_v5_field_list[] = {
+    {.key = "Serial", .label = "Sn", .source = ProtoPirateFieldSerial, .width = 32, .digits = 7},
+    {.key = "Btn", .label = "Btn", .source = ProtoPirateFieldBtn, .width = 8},
+    {.key = "Cnt", .label = "Cnt", .source = ProtoPirateFieldCnt, .width = 32, .digits = 4},
+    {.key = "DataHi", .source = ProtoPirateFieldBits, .shift = 32, .width = 32},
+    {.key = "DataLo", .source = ProtoPirateFieldBits, .width = 32},
+};
+
+static const ProtoPirateFieldMap kia_protocol_v5_fields = {
+    .key_digits = 16,
+    .fields = kia_protocol_v5_field_list,
+    .field_count = COUNT_OF(kia_protocol_v5_field_list),
+};
+
 struct SubGhzProtocolDecoderKiaV5
 {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
     uint16_t header_count;
 
     uint8_t raw_bits[32];
     uint16_t raw_bit_count;
+    ProtoPirateTraceRing *trace;
 };
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderKiaV5);
 
 struct SubGhzProtocolEncoderKiaV5
 {
@@ -133,6 +153,7 @@ void *kia_protocol_decoder_v5_alloc(SubGhzEnvironment *environment)
     SubGhzProtocolDecoderKiaV5 *instance = malloc(sizeof(SubGhzProtocolDecoderKiaV5));
     instance->base.protocol = &kia_protocol_v5;
     instance->generic.protocol_name = instance->base.protocol->name;
+    instance->trace = PROTOPIRATE_TRACE_KIA_V5 ? protopirate_trace_open() : NULL;
     return instance;
 }
 
@@ -140,6 +161,7 @@ void kia_protocol_decoder_v5_free(void *context)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV5 *instance = context;
+    protopirate_trace_close(instance->trace);
     free(instance);
 }
 
@@ -157,6 +179,7 @@ void kia_protocol_decoder_v5_feed(void *context, bool level, uint32_t duration)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV5 *instance = context;
+    instance->stats.pulses++;
 
     switch (instance->decoder.parser_step)
     {
@@ -164,6 +187,7 @@ void kia_protocol_decoder_v5_feed(void *context, bool level, uint32_t duration)
         if ((level) && (DURATION_DIFF(duration, kia_protocol_v5_const.te_short) <
                         kia_protocol_v5_const.te_delta))
         {
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = KiaV5DecoderStepCheckPreamble;
             instance->decoder.te_last = duration;
             instance->header_count = 1;
@@ -182,6 +206,7 @@ void kia_protocol_decoder_v5_feed(void *context, bool level, uint32_t duration)
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV5DecoderStepReset;
             }
         }
@@ -219,6 +244,7 @@ void kia_protocol_decoder_v5_feed(void *context, bool level, uint32_t duration)
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = KiaV5DecoderStepReset;
             }
         }
@@ -251,17 +277,23 @@ void kia_protocol_decoder_v5_feed(void *context, bool level, uint32_t duration)
                 instance->generic.btn = (uint8_t)((yek >> 61) & 0x07); // Shift btn too
                 instance->generic.cnt = (uint16_t)(yek & 0xFFFF);
 
-                FURI_LOG_I(
-                    TAG,
-                    "Key=%08lX%08lX Sn=%07lX Btn=%X",
+                PROTOPIRATE_TRACE(
+                    KIA_V5,
+                    instance->trace,
+                    ProtoPirateTraceEventKiaV5Decode,
                     (uint32_t)(instance->generic.data >> 32),
                     (uint32_t)(instance->generic.data & 0xFFFFFFFF),
                     instance->generic.serial,
                     instance->generic.btn);
 
+                instance->stats.frames++;
                 if (instance->base.callback)
                     instance->base.callback(&instance->base, instance->base.context);
             }
+            else
+            {
+                instance->stats.bit_mismatches++;
+            }
 
             instance->decoder.parser_step = KiaV5DecoderStepReset;
             break;
@@ -309,29 +341,8 @@ SubGhzProtocolStatus kia_protocol_decoder_v5_serialize(
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV5 *instance = context;
-
-    SubGhzProtocolStatus ret = SubGhzProtocolStatusError;
-
-    ret = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
-
-    if (ret == SubGhzProtocolStatusOk)
-    {
-        // Save decoded fields
-        flipper_format_write_uint32(flipper_format, "Serial", &instance->generic.serial, 1);
-
-        uint32_t temp = instance->generic.btn;
-        flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
-
-        flipper_format_write_uint32(flipper_format, "Cnt", &instance->generic.cnt, 1);
-
-        // Save raw bit data for exact reproduction (since V5 has complex bit reversal)
-        uint32_t raw_high = (uint32_t)(instance->generic.data >> 32);
-        uint32_t raw_low = (uint32_t)(instance->generic.data & 0xFFFFFFFF);
-        flipper_format_write_uint32(flipper_format, "DataHi", &raw_high, 1);
-        flipper_format_write_uint32(flipper_format, "DataLo", &raw_low, 1);
-    }
-
-    return ret;
+    return protopirate_fields_serialize(
+        &kia_protocol_v5_fields, &instance->generic, flipper_format, preset);
 }
 
 SubGhzProtocolStatus
@@ -347,20 +358,5 @@ void kia_protocol_decoder_v5_get_string(void *context, FuriString *output)
 {
     furi_assert(context);
     SubGhzProtocolDecoderKiaV5 *instance = context;
-
-    uint32_t code_found_hi = instance->generic.data >> 32;
-    uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
-
-    furi_string_cat_printf(
-        output,
-        "%s %dbit\r\n"
-        "Key:%08lX%08lX\r\n"
-        "Sn:%07lX Btn:%X Cnt:%04lX\r\n",
-        instance->generic.protocol_name,
-        instance->generic.data_count_bit,
-        code_found_hi,
-        code_found_lo,
-        instance->generic.serial,
-        instance->generic.btn,
-        instance->generic.cnt);
+    protopirate_fields_get_string(&kia_protocol_v5_fields, &instance->generic, output);
 }
@@ -0,0 +1,48 @@
+// protocols/protocol_config.h
+#pragma once
+
+// Decoders built into the app, all on by default. Fixed-purpose builds turn
+// families off with e.g. PROTOCOL_CDEFINES = ["PROTOPIRATE_PROTOCOL_VW=0"] in
+// application.fam, which also skips the decoder's plugin, or with
+// -DPROTOPIRATE_PROTOCOL_VW=0. A disabled decoder is left out of every
+// registry, manifest and dispatch table.
+#ifndef PROTOPIRATE_PROTOCOL_KIA_V0
+#define PROTOPIRATE_PROTOCOL_KIA_V0 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_KIA_V1
+#define PROTOPIRATE_PROTOCOL_KIA_V1 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_KIA_V2
+#define PROTOPIRATE_PROTOCOL_KIA_V2 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_KIA_V3_V4
+#define PROTOPIRATE_PROTOCOL_KIA_V3_V4 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_KIA_V5
+#define PROTOPIRATE_PROTOCOL_KIA_V5 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_FORD_V0
+#define PROTOPIRATE_PROTOCOL_FORD_V0 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_SUBARU
+#define PROTOPIRATE_PROTOCOL_SUBARU 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_SUZUKI
+#define PROTOPIRATE_PROTOCOL_SUZUKI 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_VW
+#define PROTOPIRATE_PROTOCOL_VW 1
+#endif
+#ifndef PROTOPIRATE_PROTOCOL_FIAT_V0
+#define PROTOPIRATE_PROTOCOL_FIAT_V0 1
+#endif
+
+// Number of selected decoders, sizes the registries and the decoder dispatch
+enum {
+#define PROTOPIRATE_PROTOCOL(protocol, ...) ProtoPirateProtocolIndex_##protocol,
+#include "protocol_list.h"
+#undef PROTOPIRATE_PROTOCOL
+    PROTOPIRATE_PROTOCOL_COUNT,
+};
+
+_Static_assert(PROTOPIRATE_PROTOCOL_COUNT > 0, "protocol_config.h selects no protocol");
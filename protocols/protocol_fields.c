@@ -0,0 +1,113 @@
+#include "protocol_fields.h"
+
+#include <inttypes.h>
+
+uint32_t protopirate_field_get_value(
+    const ProtoPirateField *field,
+    const SubGhzBlockGeneric *generic)
+{
+    uint64_t value;
+    switch (field->source)
+    {
+    case ProtoPirateFieldSerial:
+        value = generic->serial;
+        break;
+    case ProtoPirateFieldBtn:
+        value = generic->btn;
+        break;
+    case ProtoPirateFieldCnt:
+        value = generic->cnt;
+        break;
+    default:
+        value = generic->data >> field->shift;
+        break;
+    }
+
+    if (field->width < 32)
+    {
+        value &= (1ULL << field->width) - 1;
+    }
+    return (uint32_t)value;
+}
+
+void protopirate_fields_get_string(
+    const ProtoPirateFieldMap *map,
+    const SubGhzBlockGeneric *generic,
+    FuriString *output)
+{
+    furi_assert(map);
+    furi_assert(generic);
+
+    uint32_t key_hi = (uint32_t)(generic->data >> 32);
+    uint32_t key_lo = (uint32_t)(generic->data & 0xFFFFFFFF);
+
+    furi_string_cat_printf(
+        output, "%s %dbit\r\nKey:", generic->protocol_name, generic->data_count_bit);
+    if (map->key_digits > 8)
+    {
+        furi_string_cat_printf(
+            output, "%0*" PRIX32 "%08" PRIX32 "\r\n", map->key_digits - 8, key_hi, key_lo);
+    }
+    else
+    {
+        furi_string_cat_printf(output, "%0*" PRIX32 "\r\n", map->key_digits, key_lo);
+    }
+
+    bool line_open = false;
+    for (uint8_t i = 0; i < map->field_count; i++)
+    {
+        const ProtoPirateField *field = &map->fields[i];
+        if (!field->label)
+            continue;
+
+        if (line_open)
+        {
+            furi_string_cat_str(output, field->new_line ? "\r\n" : " ");
+        }
+        line_open = true;
+
+        uint32_t value = protopirate_field_get_value(field, generic);
+        furi_string_cat_printf(output, "%s:%0*" PRIX32, field->label, field->digits, value);
+        if (field->get_name)
+        {
+            furi_string_cat_printf(output, " %s", field->get_name(value));
+        }
+    }
+
+    if (line_open)
+    {
+        furi_string_cat_str(output, "\r\n");
+    }
+}
+
+SubGhzProtocolStatus protopirate_fields_serialize(
+    const ProtoPirateFieldMap *map,
+    SubGhzBlockGeneric *generic,
+    FlipperFormat *flipper_format,
+    SubGhzRadioPreset *preset)
+{
+    furi_assert(map);
+    furi_assert(generic);
+
+    SubGhzProtocolStatus ret = subghz_block_generic_serialize(generic, flipper_format, preset);
+    if (ret != SubGhzProtocolStatusOk)
+    {
+        return ret;
+    }
+
+    for (uint8_t i = 0; i < map->field_count; i++)
+    {
+        const ProtoPirateField *field = &map->fields[i];
+        if (!field->key)
+            continue;
+
+        uint32_t value = protopirate_field_get_value(field, generic);
+        if (!flipper_format_write_uint32(flipper_format, field->key, &value, 1))
+        {
+            ret = SubGhzProtocolStatusErrorParserOthers;
+            break;
+        }
+    }
+
+    return ret;
+}
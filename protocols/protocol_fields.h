@@ -0,0 +1,59 @@
+#pragma once
+
+#include "kia_generic.h"
+
+// Declarative description of the decoded fields of a protocol. One map
+// drives both get_string and the extra FlipperFormat keys written by
+// serialize, so decoders only have to fill SubGhzBlockGeneric.
+
+typedef enum
+{
+    ProtoPirateFieldSerial,
+    ProtoPirateFieldBtn,
+    ProtoPirateFieldCnt,
+    // Bits [shift, shift + width) of generic.data
+    ProtoPirateFieldBits,
+} ProtoPirateFieldSource;
+
+typedef struct
+{
+    // FlipperFormat key, NULL if the field is only shown
+    const char *key;
+    // get_string label, NULL if the field is only saved
+    const char *label;
+    ProtoPirateFieldSource source;
+    uint8_t shift;
+    // Width in bits, also masks the generic sources
+    uint8_t width;
+    // Hex digits printed, 0 for no padding
+    uint8_t digits;
+    // Start a new text line before this field
+    bool new_line;
+    // Optional text printed after the value, e.g. a button name
+    const char *(*get_name)(uint32_t value);
+} ProtoPirateField;
+
+typedef struct
+{
+    // Hex digits of the Key line
+    uint8_t key_digits;
+    const ProtoPirateField *fields;
+    uint8_t field_count;
+} ProtoPirateFieldMap;
+
+uint32_t protopirate_field_get_value(
+    const ProtoPirateField *field,
+    const SubGhzBlockGeneric *generic);
+
+// "<name> <n>bit", "Key:<data>" and every labelled field, lines end with \r\n
+void protopirate_fields_get_string(
+    const ProtoPirateFieldMap *map,
+    const SubGhzBlockGeneric *generic,
+    FuriString *output);
+
+// subghz_block_generic_serialize followed by every keyed field
+SubGhzProtocolStatus protopirate_fields_serialize(
+    const ProtoPirateFieldMap *map,
+    SubGhzBlockGeneric *generic,
+    FlipperFormat *flipper_format,
+    SubGhzRadioPreset *preset);
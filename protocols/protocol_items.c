@@ -1,16 +1,9 @@
 #include "protocol_items.h"
 
 const SubGhzProtocol* protopirate_protocol_registry_items[] = {
-    &kia_protocol_v0,
-    &kia_protocol_v1,
-    &kia_protocol_v2,
-    &kia_protocol_v3_v4,
-    &kia_protocol_v5,
-    &ford_protocol_v0,
-    &subaru_protocol,
-    &suzuki_protocol,
-    &vw_protocol,
-    &fiat_protocol_v0,
+#define PROTOPIRATE_PROTOCOL(protocol, ...) &protocol,
+#include "protocol_list.h"
+#undef PROTOPIRATE_PROTOCOL
 };
 
 const SubGhzProtocolRegistry protopirate_protocol_registry = {
@@ -3,6 +3,8 @@
 
 #include <lib/subghz/types.h>
 
+#include "protocol_config.h"
+
 #include "kia_generic.h"
 #include "kia_v0.h"
 #include "kia_v1.h"
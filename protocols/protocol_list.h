@@ -0,0 +1,107 @@
+// protocols/protocol_list.h
+// Shared decoder library and its manifest, one entry per decoder in registry order:
+// PROTOPIRATE_PROTOCOL(protocol, plugin appid, name, flags, te_short us, te_long us)
+// Include after protocol_config.h with PROTOPIRATE_PROTOCOL defined, no include
+// guard on purpose.
+// Flags and timings must match the decoder's SubGhzProtocol and <protocol>_const,
+// the app filters on them before the decoder itself is loaded and furi_checks
+// them once it is.
+#if PROTOPIRATE_PROTOCOL_KIA_V0
+PROTOPIRATE_PROTOCOL(
+    kia_protocol_v0,
+    "protopirate_kia_v0",
+    KIA_PROTOCOL_V0_NAME,
+    SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable |
+        SubGhzProtocolFlag_Save | SubGhzProtocolFlag_Send,
+    250,
+    500)
+#endif
+#if PROTOPIRATE_PROTOCOL_KIA_V1
+PROTOPIRATE_PROTOCOL(
+    kia_protocol_v1,
+    "protopirate_kia_v1",
+    KIA_PROTOCOL_V1_NAME,
+    SubGhzProtocolFlag_315 | SubGhzProtocolFlag_433 | SubGhzProtocolFlag_AM |
+        SubGhzProtocolFlag_Decodable,
+    800,
+    1600)
+#endif
+#if PROTOPIRATE_PROTOCOL_KIA_V2
+PROTOPIRATE_PROTOCOL(
+    kia_protocol_v2,
+    "protopirate_kia_v2",
+    KIA_PROTOCOL_V2_NAME,
+    SubGhzProtocolFlag_315 | SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM |
+        SubGhzProtocolFlag_Decodable,
+    500,
+    1000)
+#endif
+#if PROTOPIRATE_PROTOCOL_KIA_V3_V4
+PROTOPIRATE_PROTOCOL(
+    kia_protocol_v3_v4,
+    "protopirate_kia_v3_v4",
+    KIA_PROTOCOL_V3_V4_NAME,
+    SubGhzProtocolFlag_315 | SubGhzProtocolFlag_433 | SubGhzProtocolFlag_AM |
+        SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable,
+    400,
+    800)
+#endif
+#if PROTOPIRATE_PROTOCOL_KIA_V5
+PROTOPIRATE_PROTOCOL(
+    kia_protocol_v5,
+    "protopirate_kia_v5",
+    KIA_PROTOCOL_V5_NAME,
+    SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable,
+    400,
+    800)
+#endif
+#if PROTOPIRATE_PROTOCOL_FORD_V0
+PROTOPIRATE_PROTOCOL(
+    ford_protocol_v0,
+    "protopirate_ford_v0",
+    FORD_PROTOCOL_V0_NAME,
+    SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable |
+        SubGhzProtocolFlag_Save | SubGhzProtocolFlag_Send,
+    250,
+    500)
+#endif
+#if PROTOPIRATE_PROTOCOL_SUBARU
+PROTOPIRATE_PROTOCOL(
+    subaru_protocol,
+    "protopirate_subaru",
+    SUBARU_PROTOCOL_NAME,
+    SubGhzProtocolFlag_433 | SubGhzProtocolFlag_AM | SubGhzProtocolFlag_Decodable |
+        SubGhzProtocolFlag_Save | SubGhzProtocolFlag_Send,
+    800,
+    1600)
+#endif
+#if PROTOPIRATE_PROTOCOL_SUZUKI
+PROTOPIRATE_PROTOCOL(
+    suzuki_protocol,
+    "protopirate_suzuki",
+    SUZUKI_PROTOCOL_NAME,
+    SubGhzProtocolFlag_433 | SubGhzProtocolFlag_AM | SubGhzProtocolFlag_Decodable |
+        SubGhzProtocolFlag_Save | SubGhzProtocolFlag_Send,
+    250,
+    500)
+#endif
+#if PROTOPIRATE_PROTOCOL_VW
+PROTOPIRATE_PROTOCOL(
+    vw_protocol,
+    "protopirate_vw",
+    VW_PROTOCOL_NAME,
+    SubGhzProtocolFlag_433 | SubGhzProtocolFlag_AM | SubGhzProtocolFlag_Decodable |
+        SubGhzProtocolFlag_Save | SubGhzProtocolFlag_Send,
+    500,
+    1000)
+#endif
+#if PROTOPIRATE_PROTOCOL_FIAT_V0
+PROTOPIRATE_PROTOCOL(
+    fiat_protocol_v0,
+    "protopirate_fiat_v0",
+    FIAT_PROTOCOL_V0_NAME,
+    SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable |
+        SubGhzProtocolFlag_Save | SubGhzProtocolFlag_Send,
+    200,
+    400)
+#endif
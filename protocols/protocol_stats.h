@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stddef.h>
+#include "kia_generic.h"
+
+// Per-decoder counters bumped from the feed state machines, they tell which
+// decoders burn time on noise and which tolerances reject real frames.
+// Every decoder embeds them right behind its base/decoder/generic head so
+// the app can read them from the SubGhzProtocolDecoderBase pointer alone.
+
+// Timing grade of a frame, for decoders that recover their clock
+// (protocol_timing.h). All zero when the decoder doesn't grade its bits.
+typedef struct
+{
+    // Mean margin of the frame's durations, percent of the window left
+    uint8_t score;
+    // Smallest margin and the bit it fell on
+    uint8_t weakest;
+    uint8_t weakest_bit;
+} ProtoPirateFrameQuality;
+
+typedef struct
+{
+    // Every level/duration fed
+    uint32_t pulses;
+    // Entered the preamble check
+    uint32_t preamble_starts;
+    // Preamble check fell back to reset before the sync
+    uint32_t preamble_aborts;
+    // Frames handed to the receiver callback
+    uint32_t frames;
+    // Frames of the right length rejected by a check or decrypt
+    uint32_t checksum_fails;
+    // Frames that ended with the wrong bit count
+    uint32_t bit_mismatches;
+    // Not a counter, the last frame handed to the receiver callback
+    ProtoPirateFrameQuality quality;
+} ProtoPirateDecodeStats;
+
+typedef struct
+{
+    SubGhzProtocolDecoderBase base;
+    SubGhzBlockDecoder decoder;
+    SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
+} ProtoPirateDecoderHead;
+
+// Put next to a decoder struct, fails the build if its stats are misplaced
+#define PROTOPIRATE_DECODE_STATS_CHECK(type)                                  \
+    _Static_assert(                                                           \
+        offsetof(type, stats) == offsetof(ProtoPirateDecoderHead, stats),     \
+        #type " must declare stats right after generic")
+
+static inline ProtoPirateDecodeStats *
+protopirate_decode_stats_get(SubGhzProtocolDecoderBase *decoder)
+{
+    return &((ProtoPirateDecoderHead *)decoder)->stats;
+}
+
+// The frame the decoder last handed to the receiver callback
+static inline const SubGhzBlockGeneric *
+protopirate_decode_generic_get(SubGhzProtocolDecoderBase *decoder)
+{
+    return &((ProtoPirateDecoderHead *)decoder)->generic;
+}
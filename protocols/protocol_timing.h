@@ -0,0 +1,118 @@
+#pragma once
+
+#include "kia_generic.h"
+#include "protocol_stats.h"
+
+// Clock recovery from a preamble. A fob's oscillator drifts a few percent
+// from the nominal te_short, and the fixed te_delta windows have to be wide
+// enough for every fob. Averaging the preamble a decoder just matched gives
+// this fob's actual period, the frame's data is then classified around it:
+// a drifted fob stays centred in its windows instead of at their edge.
+//
+// Average both levels where a preamble has them, AM stretches the high
+// pulses and shrinks the lows by about the same amount.
+//
+// Every symbol, short or long, keeps the nominal te_delta as its window
+// (never more than half a period), only its centre moves to the recovered
+// length. Narrower windows would be the next step, but on the host bench
+// (tools/host/bench) even 3/4 of te_delta for single periods lost every
+// Kia V0 and Suzuki frame of the worst profile, so they stay nominal on
+// purpose until real captures say otherwise.
+//
+// The margin each data duration leaves to the edge of its window grades the
+// frame: a clean capture sits near the recovered period, a marginal one has
+// bits that barely made it. Margins are percent of the window.
+
+// Fewer preamble periods than this keep the nominal timing
+#define PROTOPIRATE_TIMING_MIN_UNITS 8
+// Older periods are halved away from here on, the ones next to the data count most
+#define PROTOPIRATE_TIMING_MAX_UNITS 64
+
+typedef struct
+{
+    // Preamble durations and the te_short periods they span
+    uint32_t sum;
+    uint16_t units;
+    // Period and symbol window the data is classified with, valid after lock
+    uint16_t te;
+    uint16_t delta;
+    // Margins of the graded data durations since the lock, percent
+    uint32_t margin_sum;
+    uint16_t margin_count;
+    uint8_t margin_min;
+    uint8_t margin_min_bit;
+} ProtoPirateTiming;
+
+static inline void protopirate_timing_reset(ProtoPirateTiming *timing)
+{
+    timing->sum = 0;
+    timing->units = 0;
+}
+
+/** A preamble duration the decoder matched, units is its length in te_short */
+static inline void protopirate_timing_add(ProtoPirateTiming *timing, uint32_t duration, uint8_t units)
+{
+    if (timing->units >= PROTOPIRATE_TIMING_MAX_UNITS)
+    {
+        timing->sum >>= 1;
+        timing->units >>= 1;
+    }
+    timing->sum += duration;
+    timing->units += units;
+}
+
+/** End of the preamble, fixes the period for the data that follows */
+static inline void protopirate_timing_lock(ProtoPirateTiming *timing, const SubGhzBlockConst *nominal)
+{
+    timing->margin_sum = 0;
+    timing->margin_count = 0;
+    timing->margin_min = 100;
+    timing->margin_min_bit = 0;
+    if (timing->units < PROTOPIRATE_TIMING_MIN_UNITS)
+    {
+        timing->te = nominal->te_short;
+        timing->delta = nominal->te_delta;
+        return;
+    }
+
+    // The preamble already passed the nominal window, the mean can't sit far outside it
+    uint32_t te = timing->sum / timing->units;
+    te = MAX(te, (uint32_t)(nominal->te_short - nominal->te_delta));
+    te = MIN(te, (uint32_t)(nominal->te_short + nominal->te_delta));
+    timing->te = te;
+    timing->delta = MIN((uint32_t)nominal->te_delta, te / 2);
+}
+
+/** Whether a locked data duration is units te_short periods long */
+static inline bool protopirate_timing_match(const ProtoPirateTiming *timing, uint32_t duration, uint8_t units)
+{
+    return DURATION_DIFF(duration, (uint32_t)timing->te * units) < timing->delta;
+}
+
+/** Grade a duration that matched units periods, bit is the index it decides */
+static inline void protopirate_timing_grade(ProtoPirateTiming *timing, uint32_t duration, uint8_t units, uint8_t bit)
+{
+    uint32_t diff = DURATION_DIFF(duration, (uint32_t)timing->te * units);
+    uint8_t margin = diff < timing->delta ? (timing->delta - diff) * 100 / timing->delta : 0;
+    timing->margin_sum += margin;
+    timing->margin_count++;
+    if (margin < timing->margin_min)
+    {
+        timing->margin_min = margin;
+        timing->margin_min_bit = bit;
+    }
+}
+
+/** Grade of the durations since the lock, call when the frame completes */
+static inline void protopirate_timing_get_quality(const ProtoPirateTiming *timing, ProtoPirateFrameQuality *quality)
+{
+    if (!timing->margin_count)
+    {
+        memset(quality, 0, sizeof(ProtoPirateFrameQuality));
+        return;
+    }
+    // Never 0, that means ungraded
+    quality->score = MAX(timing->margin_sum / timing->margin_count, 1UL);
+    quality->weakest = timing->margin_min;
+    quality->weakest_bit = timing->margin_min_bit;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <furi.h>
+#include <furi_hal.h>
+
+// Binary trace of decoder and receiver events, the cheap replacement for
+// FURI_LOG on hot paths: a record is a cycle stamp, an event id and four
+// integers written to a RAM ring, the text is only produced on the PC by
+// tools/protopirate_trace.py from an SD dump.
+//
+// The app owns the ring and publishes it as a furi record so decoders
+// built as plugins reach it too. Without the record (pirateproto2, or a
+// decoder allocated before the app) the trace points do nothing.
+//
+// Gates compile a module's trace points out, e.g.
+// cdefines=["PROTOPIRATE_TRACE_KIA_V1=0"] in application.fam.
+#ifndef PROTOPIRATE_TRACE_KIA_V1
+#define PROTOPIRATE_TRACE_KIA_V1 1
+#endif
+#ifndef PROTOPIRATE_TRACE_KIA_V5
+#define PROTOPIRATE_TRACE_KIA_V5 1
+#endif
+#ifndef PROTOPIRATE_TRACE_RECEIVER
+#define PROTOPIRATE_TRACE_RECEIVER 1
+#endif
+
+#define PROTOPIRATE_TRACE_RECORD "protopirate_trace"
+// Records kept, a power of two
+#define PROTOPIRATE_TRACE_SIZE 256
+
+// Ids are stored in dumps, only append. tools/protopirate_trace.py mirrors them
+typedef enum
+{
+    ProtoPirateTraceEventNone = 0,
+    // header_count
+    ProtoPirateTraceEventKiaV1Sync = 0x0101,
+    // raw_bit_count
+    ProtoPirateTraceEventKiaV1End = 0x0102,
+    // raw_bits[0..3] big endian, raw_bits[4..5], raw_bit_count
+    ProtoPirateTraceEventKiaV1Raw = 0x0103,
+    // offset, bits, data high, data low
+    ProtoPirateTraceEventKiaV1Best = 0x0104,
+    // data high, data low, serial, btn << 8 | cnt
+    ProtoPirateTraceEventKiaV1Decode = 0x0105,
+    // level, duration, raw_bit_count
+    ProtoPirateTraceEventKiaV1BadPulse = 0x0106,
+    // data high, data low, serial, btn
+    ProtoPirateTraceEventKiaV5Decode = 0x0201,
+    // decoder hash, added to history, history count
+    ProtoPirateTraceEventReceiverFrame = 0x1001,
+} ProtoPirateTraceEvent;
+
+typedef struct
+{
+    // Slot number + 1, written last, a dump skips slots it doesn't match
+    uint32_t seq;
+    // DWT cycle counter
+    uint32_t time;
+    uint16_t event;
+    uint16_t reserved;
+    uint32_t arg[4];
+} ProtoPirateTraceEntry;
+_Static_assert(
+    sizeof(ProtoPirateTraceEntry) == 28,
+    "tools/protopirate_trace.py reads 28 byte records");
+
+typedef struct
+{
+    // Slots ever claimed, the newest record is head - 1
+    volatile uint32_t head;
+    ProtoPirateTraceEntry entry[PROTOPIRATE_TRACE_SIZE];
+} ProtoPirateTraceRing;
+
+// Lock-free, any thread or ISR may write while another one does
+static inline void protopirate_trace_add(
+    ProtoPirateTraceRing *ring,
+    ProtoPirateTraceEvent event,
+    uint32_t arg0,
+    uint32_t arg1,
+    uint32_t arg2,
+    uint32_t arg3)
+{
+    if (!ring)
+    {
+        return;
+    }
+    uint32_t slot = __atomic_fetch_add(&ring->head, 1, __ATOMIC_RELAXED);
+    ProtoPirateTraceEntry *entry = &ring->entry[slot & (PROTOPIRATE_TRACE_SIZE - 1)];
+    __atomic_store_n(&entry->seq, 0, __ATOMIC_RELAXED);
+    entry->time = DWT->CYCCNT;
+    entry->event = event;
+    entry->arg[0] = arg0;
+    entry->arg[1] = arg1;
+    entry->arg[2] = arg2;
+    entry->arg[3] = arg3;
+    __atomic_store_n(&entry->seq, slot + 1, __ATOMIC_RELEASE);
+}
+
+// Trace point of a gated module, compiled out when the gate is 0
+#define PROTOPIRATE_TRACE(module, ring, event, arg0, arg1, arg2, arg3)      \
+    do                                                                     \
+    {                                                                      \
+        if (PROTOPIRATE_TRACE_##module)                                    \
+        {                                                                  \
+            protopirate_trace_add(ring, event, arg0, arg1, arg2, arg3);    \
+        }                                                                  \
+    } while (0)
+
+/** The app's ring if it is running, pair with protopirate_trace_close() */
+static inline ProtoPirateTraceRing *protopirate_trace_open(void)
+{
+    if (!furi_record_exists(PROTOPIRATE_TRACE_RECORD))
+    {
+        return NULL;
+    }
+    return furi_record_open(PROTOPIRATE_TRACE_RECORD);
+}
+
+static inline void protopirate_trace_close(ProtoPirateTraceRing *ring)
+{
+    if (ring)
+    {
+        furi_record_close(PROTOPIRATE_TRACE_RECORD);
+    }
+}
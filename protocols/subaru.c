@@ -1,19 +1,38 @@
 #include "subaru.h"
+#include "protocol_fields.h"
+#include "protocol_stats.h"
+
+#include <inttypes.h>
 
 #define TAG "SubaruProtocol"
 
-static const SubGhzBlockConst subghz_protocol_subaru_const = {
+const SubGhzBlockConst subaru_protocol_const = {
     .te_short = 800,
     .te_long = 1600,
     .te_delta = 250,
     .min_count_bit_for_found = 64,
 };
 
+static const ProtoPirateField subghz_protocol_subaru_field_list[] = {
+    {.key = "Serial", .label = "Sn", .source = ProtoPirateFieldSerial, .width = 32, .digits = 6},
+    {.key = "Btn", .label = "Btn", .source = ProtoPirateFieldBtn, .width = 8},
+    {.key = "Cnt", .label = "Cnt", .source = ProtoPirateFieldCnt, .width = 16, .digits = 4},
+    {.key = "DataHi", .source = ProtoPirateFieldBits, .shift = 32, .width = 32},
+    {.key = "DataLo", .source = ProtoPirateFieldBits, .width = 32},
+};
+
+static const ProtoPirateFieldMap subghz_protocol_subaru_fields = {
+    .key_digits = 16,
+    .fields = subghz_protocol_subaru_field_list,
+    .field_count = COUNT_OF(subghz_protocol_subaru_field_list),
+};
+
 typedef struct SubGhzProtocolDecoderSubaru
 {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
 
     uint16_t header_count;
     uint16_t bit_count;
@@ -24,6 +43,7 @@ typedef struct SubGhzProtocolDecoderSubaru
     uint8_t button;
     uint16_t count;
 } SubGhzProtocolDecoderSubaru;
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderSubaru);
 
 typedef struct SubGhzProtocolEncoderSubaru
 {
@@ -189,7 +209,7 @@ SubGhzProtocolStatus subghz_protocol_encoder_subaru_deserialize(void *context, F
 
         // Parse hex key
         uint64_t key = 0;
-        if (sscanf(furi_string_get_cstr(temp_str), "%016llX", &key) != 1)
+        if (sscanf(furi_string_get_cstr(temp_str), "%016" SCNx64, &key) != 1)
         {
             FURI_LOG_E(TAG, "Failed to parse Key");
             furi_string_free(temp_str);
@@ -240,13 +260,13 @@ LevelDuration subghz_protocol_encoder_subaru_yield(void *context)
         if (is_high)
         {
             is_high = false;
-            return level_duration_make(true, subghz_protocol_subaru_const.te_long);
+            return level_duration_make(true, subaru_protocol_const.te_long);
         }
         else
         {
             is_high = true;
             preamble_count++;
-            return level_duration_make(false, subghz_protocol_subaru_const.te_long);
+            return level_duration_make(false, subaru_protocol_const.te_long);
         }
     }
 
@@ -267,7 +287,7 @@ LevelDuration subghz_protocol_encoder_subaru_yield(void *context)
     if (preamble_count == 26)
     {
         preamble_count++;
-        return level_duration_make(true, subghz_protocol_subaru_const.te_long);
+        return level_duration_make(true, subaru_protocol_const.te_long);
     }
 
     if (preamble_count == 27)
@@ -275,7 +295,7 @@ LevelDuration subghz_protocol_encoder_subaru_yield(void *context)
         preamble_count++;
         bit_index = 0;
         is_high = true;
-        return level_duration_make(false, subghz_protocol_subaru_const.te_long);
+        return level_duration_make(false, subaru_protocol_const.te_long);
     }
 
     // Send data bits
@@ -287,7 +307,7 @@ LevelDuration subghz_protocol_encoder_subaru_yield(void *context)
         {
             is_high = false;
             // Subaru encoding: 1 = short high, 0 = long high
-            uint32_t duration = current_bit ? subghz_protocol_subaru_const.te_short : subghz_protocol_subaru_const.te_long;
+            uint32_t duration = current_bit ? subaru_protocol_const.te_short : subaru_protocol_const.te_long;
             return level_duration_make(true, duration);
         }
         else
@@ -295,7 +315,7 @@ LevelDuration subghz_protocol_encoder_subaru_yield(void *context)
             is_high = true;
             bit_index++;
             // LOW pulse duration matches the previous HIGH duration
-            uint32_t duration = current_bit ? subghz_protocol_subaru_const.te_short : subghz_protocol_subaru_const.te_long;
+            uint32_t duration = current_bit ? subaru_protocol_const.te_short : subaru_protocol_const.te_long;
             
             if (bit_index >= instance->generic.data_count_bit)
             {
@@ -467,12 +487,14 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
 {
     furi_assert(context);
     SubGhzProtocolDecoderSubaru *instance = context;
+    instance->stats.pulses++;
 
     switch (instance->decoder.parser_step)
     {
     case SubaruDecoderStepReset:
-        if (level && DURATION_DIFF(duration, subghz_protocol_subaru_const.te_long) < subghz_protocol_subaru_const.te_delta)
+        if (level && DURATION_DIFF(duration, subaru_protocol_const.te_long) < subaru_protocol_const.te_delta)
         {
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = SubaruDecoderStepCheckPreamble;
             instance->decoder.te_last = duration;
             instance->header_count = 1;
@@ -482,7 +504,7 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
     case SubaruDecoderStepCheckPreamble:
         if (!level)
         {
-            if (DURATION_DIFF(duration, subghz_protocol_subaru_const.te_long) < subghz_protocol_subaru_const.te_delta)
+            if (DURATION_DIFF(duration, subaru_protocol_const.te_long) < subaru_protocol_const.te_delta)
             {
                 instance->header_count++;
             }
@@ -494,23 +516,26 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
                 }
                 else
                 {
+                    instance->stats.preamble_aborts++;
                     instance->decoder.parser_step = SubaruDecoderStepReset;
                 }
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = SubaruDecoderStepReset;
             }
         }
         else
         {
-            if (DURATION_DIFF(duration, subghz_protocol_subaru_const.te_long) < subghz_protocol_subaru_const.te_delta)
+            if (DURATION_DIFF(duration, subaru_protocol_const.te_long) < subaru_protocol_const.te_delta)
             {
                 instance->decoder.te_last = duration;
                 instance->header_count++;
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = SubaruDecoderStepReset;
             }
         }
@@ -523,12 +548,13 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
         }
         else
         {
+            instance->stats.preamble_aborts++;
             instance->decoder.parser_step = SubaruDecoderStepReset;
         }
         break;
 
     case SubaruDecoderStepFoundSync:
-        if (!level && DURATION_DIFF(duration, subghz_protocol_subaru_const.te_long) < subghz_protocol_subaru_const.te_delta)
+        if (!level && DURATION_DIFF(duration, subaru_protocol_const.te_long) < subaru_protocol_const.te_delta)
         {
             instance->decoder.parser_step = SubaruDecoderStepSaveDuration;
             instance->bit_count = 0;
@@ -536,6 +562,7 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
         }
         else
         {
+            instance->stats.preamble_aborts++;
             instance->decoder.parser_step = SubaruDecoderStepReset;
         }
         break;
@@ -546,14 +573,14 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
             // HIGH pulse duration encodes the bit:
             // Short HIGH (~800µs) = 1
             // Long HIGH (~1600µs) = 0
-            if (DURATION_DIFF(duration, subghz_protocol_subaru_const.te_short) < subghz_protocol_subaru_const.te_delta)
+            if (DURATION_DIFF(duration, subaru_protocol_const.te_short) < subaru_protocol_const.te_delta)
             {
                 // Short HIGH = bit 1
                 subaru_add_bit(instance, true);
                 instance->decoder.te_last = duration;
                 instance->decoder.parser_step = SubaruDecoderStepCheckDuration;
             }
-            else if (DURATION_DIFF(duration, subghz_protocol_subaru_const.te_long) < subghz_protocol_subaru_const.te_delta)
+            else if (DURATION_DIFF(duration, subaru_protocol_const.te_long) < subaru_protocol_const.te_delta)
             {
                 // Long HIGH = bit 0
                 subaru_add_bit(instance, false);
@@ -573,12 +600,17 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
                         instance->generic.btn = instance->button;
                         instance->generic.cnt = instance->count;
 
+                        instance->stats.frames++;
                         if (instance->base.callback)
                         {
                             instance->base.callback(&instance->base, instance->base.context);
                         }
                     }
                 }
+                else
+                {
+                    instance->stats.bit_mismatches++;
+                }
                 instance->decoder.parser_step = SubaruDecoderStepReset;
             }
             else
@@ -596,8 +628,8 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
         if (!level)
         {
             // LOW pulse - just validates timing, doesn't encode bit
-            if (DURATION_DIFF(duration, subghz_protocol_subaru_const.te_short) < subghz_protocol_subaru_const.te_delta ||
-                DURATION_DIFF(duration, subghz_protocol_subaru_const.te_long) < subghz_protocol_subaru_const.te_delta)
+            if (DURATION_DIFF(duration, subaru_protocol_const.te_short) < subaru_protocol_const.te_delta ||
+                DURATION_DIFF(duration, subaru_protocol_const.te_long) < subaru_protocol_const.te_delta)
             {
                 instance->decoder.parser_step = SubaruDecoderStepSaveDuration;
             }
@@ -614,12 +646,17 @@ void subghz_protocol_decoder_subaru_feed(void *context, bool level, uint32_t dur
                         instance->generic.btn = instance->button;
                         instance->generic.cnt = instance->count;
 
+                        instance->stats.frames++;
                         if (instance->base.callback)
                         {
                             instance->base.callback(&instance->base, instance->base.context);
                         }
                     }
                 }
+                else
+                {
+                    instance->stats.bit_mismatches++;
+                }
                 instance->decoder.parser_step = SubaruDecoderStepReset;
             }
             else
@@ -650,30 +687,8 @@ SubGhzProtocolStatus subghz_protocol_decoder_subaru_serialize(
 {
     furi_assert(context);
     SubGhzProtocolDecoderSubaru *instance = context;
-
-    SubGhzProtocolStatus ret = SubGhzProtocolStatusError;
-
-    ret = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
-
-    if (ret == SubGhzProtocolStatusOk)
-    {
-        // Subaru specific data - the counter uses special decoding
-        flipper_format_write_uint32(flipper_format, "Serial", &instance->serial, 1);
-
-        uint32_t temp = instance->button;
-        flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
-
-        temp = instance->count;
-        flipper_format_write_uint32(flipper_format, "Cnt", &temp, 1);
-
-        // Save raw data for exact reproduction
-        uint32_t raw_high = (uint32_t)(instance->key >> 32);
-        uint32_t raw_low = (uint32_t)(instance->key & 0xFFFFFFFF);
-        flipper_format_write_uint32(flipper_format, "DataHi", &raw_high, 1);
-        flipper_format_write_uint32(flipper_format, "DataLo", &raw_low, 1);
-    }
-
-    return ret;
+    return protopirate_fields_serialize(
+        &subghz_protocol_subaru_fields, &instance->generic, flipper_format, preset);
 }
 
 SubGhzProtocolStatus subghz_protocol_decoder_subaru_deserialize(void *context, FlipperFormat *flipper_format)
@@ -681,27 +696,12 @@ SubGhzProtocolStatus subghz_protocol_decoder_subaru_deserialize(void *context, F
     furi_assert(context);
     SubGhzProtocolDecoderSubaru *instance = context;
     return subghz_block_generic_deserialize_check_count_bit(
-        &instance->generic, flipper_format, subghz_protocol_subaru_const.min_count_bit_for_found);
+        &instance->generic, flipper_format, subaru_protocol_const.min_count_bit_for_found);
 }
 
 void subghz_protocol_decoder_subaru_get_string(void *context, FuriString *output)
 {
     furi_assert(context);
     SubGhzProtocolDecoderSubaru *instance = context;
-
-    uint32_t key_hi = (uint32_t)(instance->key >> 32);
-    uint32_t key_lo = (uint32_t)(instance->key & 0xFFFFFFFF);
-
-    furi_string_cat_printf(
-        output,
-        "%s %dbit\r\n"
-        "Key:%08lX%08lX\r\n"
-        "Sn:%06lX Btn:%X Cnt:%04X\r\n",
-        instance->generic.protocol_name,
-        instance->generic.data_count_bit,
-        key_hi,
-        key_lo,
-        instance->serial,
-        instance->button,
-        instance->count);
+    protopirate_fields_get_string(&subghz_protocol_subaru_fields, &instance->generic, output);
 }
@@ -1,14 +1,49 @@
 #include "suzuki.h"
+#include "protocol_fields.h"
+#include "protocol_stats.h"
+#include "protocol_timing.h"
+
+#include <inttypes.h>
 
 #define TAG "SuzukiProtocol"
 
-static const SubGhzBlockConst subghz_protocol_suzuki_const = {
+const SubGhzBlockConst suzuki_protocol_const = {
     .te_short = 250,
     .te_long = 500,
     .te_delta = 100,
     .min_count_bit_for_found = 64,
 };
 
+static const char *suzuki_get_button_name(uint32_t btn)
+{
+    switch (btn)
+    {
+    case 1:
+        return "PANIC";
+    case 2:
+        return "TRUNK";
+    case 3:
+        return "LOCK";
+    case 4:
+        return "UNLOCK";
+    default:
+        return "Unknown";
+    }
+}
+
+static const ProtoPirateField subghz_protocol_suzuki_field_list[] = {
+    {.key = "Serial", .label = "Sn", .source = ProtoPirateFieldSerial, .width = 32, .digits = 7},
+    {.key = "Btn", .label = "Btn", .source = ProtoPirateFieldBtn, .width = 8, .get_name = suzuki_get_button_name},
+    {.key = "Cnt", .label = "Cnt", .source = ProtoPirateFieldCnt, .width = 32, .digits = 4, .new_line = true},
+    {.key = "CRC", .label = "CRC", .source = ProtoPirateFieldBits, .shift = 4, .width = 8, .digits = 2},
+};
+
+static const ProtoPirateFieldMap subghz_protocol_suzuki_fields = {
+    .key_digits = 16,
+    .fields = subghz_protocol_suzuki_field_list,
+    .field_count = COUNT_OF(subghz_protocol_suzuki_field_list),
+};
+
 #define SUZUKI_GAP_TIME 2000
 #define SUZUKI_GAP_DELTA 400
 
@@ -17,13 +52,16 @@ typedef struct SubGhzProtocolDecoderSuzuki
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
 
     uint32_t te_last;
     uint32_t data_low;
     uint32_t data_high;
     uint8_t data_count_bit;
     uint16_t header_count;
+    ProtoPirateTiming timing;
 } SubGhzProtocolDecoderSuzuki;
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderSuzuki);
 
 typedef struct SubGhzProtocolEncoderSuzuki
 {
@@ -156,7 +194,7 @@ SubGhzProtocolStatus subghz_protocol_encoder_suzuki_deserialize(void *context, F
 
         // Parse hex key
         uint64_t key = 0;
-        if (sscanf(furi_string_get_cstr(temp_str), "%016llX", &key) != 1)
+        if (sscanf(furi_string_get_cstr(temp_str), "%016" SCNx64, &key) != 1)
         {
             FURI_LOG_E(TAG, "Failed to parse Key");
             furi_string_free(temp_str);
@@ -207,13 +245,13 @@ LevelDuration subghz_protocol_encoder_suzuki_yield(void *context)
         if (is_high)
         {
             is_high = false;
-            return level_duration_make(true, subghz_protocol_suzuki_const.te_short);
+            return level_duration_make(true, suzuki_protocol_const.te_short);
         }
         else
         {
             is_high = true;
             preamble_count++;
-            return level_duration_make(false, subghz_protocol_suzuki_const.te_short);
+            return level_duration_make(false, suzuki_protocol_const.te_short);
         }
     }
 
@@ -221,7 +259,7 @@ LevelDuration subghz_protocol_encoder_suzuki_yield(void *context)
     if (preamble_count == 128)
     {
         preamble_count++;
-        return level_duration_make(true, subghz_protocol_suzuki_const.te_long);
+        return level_duration_make(true, suzuki_protocol_const.te_long);
     }
 
     if (preamble_count == 129)
@@ -229,7 +267,7 @@ LevelDuration subghz_protocol_encoder_suzuki_yield(void *context)
         preamble_count++;
         bit_index = 0;
         is_high = true;
-        return level_duration_make(false, subghz_protocol_suzuki_const.te_long);
+        return level_duration_make(false, suzuki_protocol_const.te_long);
     }
 
     // Send data bits
@@ -241,7 +279,7 @@ LevelDuration subghz_protocol_encoder_suzuki_yield(void *context)
         {
             is_high = false;
             // Suzuki encoding: 1 = long high, 0 = short high
-            uint32_t duration = current_bit ? subghz_protocol_suzuki_const.te_long : subghz_protocol_suzuki_const.te_short;
+            uint32_t duration = current_bit ? suzuki_protocol_const.te_long : suzuki_protocol_const.te_short;
             return level_duration_make(true, duration);
         }
         else
@@ -249,7 +287,7 @@ LevelDuration subghz_protocol_encoder_suzuki_yield(void *context)
             is_high = true;
             bit_index++;
             // LOW pulse duration matches the previous HIGH duration
-            uint32_t duration = current_bit ? subghz_protocol_suzuki_const.te_long : subghz_protocol_suzuki_const.te_short;
+            uint32_t duration = current_bit ? suzuki_protocol_const.te_long : suzuki_protocol_const.te_short;
             
             if (bit_index >= instance->generic.data_count_bit)
             {
@@ -321,6 +359,7 @@ void subghz_protocol_decoder_suzuki_feed(void *context, bool level, uint32_t dur
 {
     furi_assert(context);
     SubGhzProtocolDecoderSuzuki *instance = context;
+    instance->stats.pulses++;
 
     switch (instance->decoder.parser_step)
     {
@@ -329,22 +368,30 @@ void subghz_protocol_decoder_suzuki_feed(void *context, bool level, uint32_t dur
         if (!level)
             return;
 
-        if (DURATION_DIFF(duration, subghz_protocol_suzuki_const.te_short) > subghz_protocol_suzuki_const.te_delta)
+        if (DURATION_DIFF(duration, suzuki_protocol_const.te_short) > suzuki_protocol_const.te_delta)
         {
             return;
         }
 
         instance->data_low = 0;
         instance->data_high = 0;
+        instance->stats.preamble_starts++;
         instance->decoder.parser_step = SuzukiDecoderStepFoundStartPulse;
         instance->header_count = 0;
         instance->data_count_bit = 0;
+        protopirate_timing_reset(&instance->timing);
+        protopirate_timing_add(&instance->timing, duration, 1);
         break;
 
     case SuzukiDecoderStepFoundStartPulse:
         if (level)
         {
             // HIGH pulse
+            // Short HIGHs of the preamble clock the data, which is PWM on HIGH only
+            if (DURATION_DIFF(duration, suzuki_protocol_const.te_short) < suzuki_protocol_const.te_delta)
+            {
+                protopirate_timing_add(&instance->timing, duration, 1);
+            }
             if (instance->header_count < 257)
             {
                 // Still in preamble - just count
@@ -352,8 +399,9 @@ void subghz_protocol_decoder_suzuki_feed(void *context, bool level, uint32_t dur
             }
 
             // After preamble, look for long HIGH to start data
-            if (DURATION_DIFF(duration, subghz_protocol_suzuki_const.te_long) < subghz_protocol_suzuki_const.te_delta)
+            if (DURATION_DIFF(duration, suzuki_protocol_const.te_long) < suzuki_protocol_const.te_delta)
             {
+                protopirate_timing_lock(&instance->timing, &suzuki_protocol_const);
                 instance->decoder.parser_step = SuzukiDecoderStepSaveDuration;
                 suzuki_add_bit(instance, 1);
             }
@@ -362,13 +410,14 @@ void subghz_protocol_decoder_suzuki_feed(void *context, bool level, uint32_t dur
         else
         {
             // LOW pulse - count as header if short
-            if (DURATION_DIFF(duration, subghz_protocol_suzuki_const.te_short) < subghz_protocol_suzuki_const.te_delta)
+            if (DURATION_DIFF(duration, suzuki_protocol_const.te_short) < suzuki_protocol_const.te_delta)
             {
                 instance->te_last = duration;
                 instance->header_count++;
             }
             else
             {
+                instance->stats.preamble_aborts++;
                 instance->decoder.parser_step = SuzukiDecoderStepReset;
             }
         }
@@ -378,13 +427,15 @@ void subghz_protocol_decoder_suzuki_feed(void *context, bool level, uint32_t dur
         if (level)
         {
             // HIGH pulse - determines bit value
-            // Long HIGH (~500µs) = 1, Short HIGH (~250µs) = 0
-            if (DURATION_DIFF(duration, subghz_protocol_suzuki_const.te_long) < subghz_protocol_suzuki_const.te_delta)
+            // Long HIGH (~500µs) = 1, Short HIGH (~250µs) = 0, around the preamble's period
+            if (protopirate_timing_match(&instance->timing, duration, 2))
             {
+                protopirate_timing_grade(&instance->timing, duration, 2, instance->data_count_bit);
                 suzuki_add_bit(instance, 1);
             }
-            else if (DURATION_DIFF(duration, subghz_protocol_suzuki_const.te_short) < subghz_protocol_suzuki_const.te_delta)
+            else if (protopirate_timing_match(&instance->timing, duration, 1))
             {
+                protopirate_timing_grade(&instance->timing, duration, 1, instance->data_count_bit);
                 suzuki_add_bit(instance, 0);
             }
             else
@@ -415,11 +466,21 @@ void subghz_protocol_decoder_suzuki_feed(void *context, bool level, uint32_t dur
                         instance->generic.btn = serial_button & 0xF;
                         instance->generic.cnt = (data >> 44) & 0xFFFF;
 
+                        protopirate_timing_get_quality(&instance->timing, &instance->stats.quality);
+                        instance->stats.frames++;
                         if (instance->base.callback)
                         {
                             instance->base.callback(&instance->base, instance->base.context);
                         }
                     }
+                    else
+                    {
+                        instance->stats.checksum_fails++;
+                    }
+                }
+                else
+                {
+                    instance->stats.bit_mismatches++;
                 }
                 instance->decoder.parser_step = SuzukiDecoderStepReset;
             }
@@ -444,27 +505,8 @@ SubGhzProtocolStatus subghz_protocol_decoder_suzuki_serialize(
 {
     furi_assert(context);
     SubGhzProtocolDecoderSuzuki *instance = context;
-
-    SubGhzProtocolStatus ret = SubGhzProtocolStatusError;
-
-    ret = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
-
-    if (ret == SubGhzProtocolStatusOk)
-    {
-        // Extract and save CRC
-        uint32_t crc = (instance->generic.data >> 4) & 0xFF;
-        flipper_format_write_uint32(flipper_format, "CRC", &crc, 1);
-
-        // Save decoded fields
-        flipper_format_write_uint32(flipper_format, "Serial", &instance->generic.serial, 1);
-
-        uint32_t temp = instance->generic.btn;
-        flipper_format_write_uint32(flipper_format, "Btn", &temp, 1);
-
-        flipper_format_write_uint32(flipper_format, "Cnt", &instance->generic.cnt, 1);
-    }
-
-    return ret;
+    return protopirate_fields_serialize(
+        &subghz_protocol_suzuki_fields, &instance->generic, flipper_format, preset);
 }
 
 SubGhzProtocolStatus subghz_protocol_decoder_suzuki_deserialize(void *context, FlipperFormat *flipper_format)
@@ -474,46 +516,9 @@ SubGhzProtocolStatus subghz_protocol_decoder_suzuki_deserialize(void *context, F
     return subghz_block_generic_deserialize(&instance->generic, flipper_format);
 }
 
-static const char *suzuki_get_button_name(uint8_t btn)
-{
-    switch (btn)
-    {
-    case 1:
-        return "PANIC";
-    case 2:
-        return "TRUNK";
-    case 3:
-        return "LOCK";
-    case 4:
-        return "UNLOCK";
-    default:
-        return "Unknown";
-    }
-}
-
 void subghz_protocol_decoder_suzuki_get_string(void *context, FuriString *output)
 {
     furi_assert(context);
     SubGhzProtocolDecoderSuzuki *instance = context;
-
-    uint64_t data = instance->generic.data;
-    uint32_t key_high = (data >> 32) & 0xFFFFFFFF;
-    uint32_t key_low = data & 0xFFFFFFFF;
-    uint8_t crc = (data >> 4) & 0xFF;
-
-    furi_string_cat_printf(
-        output,
-        "%s %dbit\r\n"
-        "Key:%08lX%08lX\r\n"
-        "Sn:%07lX Btn:%X %s\r\n"
-        "Cnt:%04lX CRC:%02X\r\n",
-        instance->generic.protocol_name,
-        instance->generic.data_count_bit,
-        key_high,
-        key_low,
-        instance->generic.serial,
-        instance->generic.btn,
-        suzuki_get_button_name(instance->generic.btn),
-        instance->generic.cnt,
-        crc);
+    protopirate_fields_get_string(&subghz_protocol_suzuki_fields, &instance->generic, output);
 }
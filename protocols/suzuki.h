@@ -13,6 +13,7 @@
 #define SUZUKI_PROTOCOL_NAME "Suzuki"
 
 extern const SubGhzProtocol suzuki_protocol;
+extern const SubGhzBlockConst suzuki_protocol_const;
 
 void* subghz_protocol_decoder_suzuki_alloc(SubGhzEnvironment* environment);
 void subghz_protocol_decoder_suzuki_free(void* context);
@@ -1,8 +1,11 @@
 #include "vw.h"
+#include "protocol_stats.h"
+
+#include <inttypes.h>
 
 #define TAG "VWProtocol"
 
-static const SubGhzBlockConst subghz_protocol_vw_const = {
+const SubGhzBlockConst vw_protocol_const = {
     .te_short = 500,
     .te_long = 1000,
     .te_delta = 120,
@@ -14,18 +17,24 @@ typedef struct SubGhzProtocolDecoderVw
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
+    ProtoPirateDecodeStats stats;
 
     ManchesterState manchester_state;
     uint64_t data_2; // Additional 16 bits (type byte + check byte)
 } SubGhzProtocolDecoderVw;
+PROTOPIRATE_DECODE_STATS_CHECK(SubGhzProtocolDecoderVw);
 
 typedef struct SubGhzProtocolEncoderVw
 {
     SubGhzProtocolEncoderBase base;
     SubGhzProtocolBlockEncoder encoder;
     SubGhzBlockGeneric generic;
+    uint64_t data_2; // Type byte << 8 | check byte, as in the decoder
 } SubGhzProtocolEncoderVw;
 
+// Sync pulses between te_short and te_long, same as the decoder's te_med
+#define VW_TE_MED ((vw_protocol_const.te_long + vw_protocol_const.te_short) / 2)
+
 typedef enum
 {
     VwDecoderStepReset = 0,
@@ -61,13 +70,8 @@ static void vw_reconstruct_data(SubGhzProtocolEncoderVw *instance, uint8_t type,
     // Check byte goes into the low 8 bits of data_2
     
     // For encoding, we'll reconstruct the full 80-bit structure
-    uint64_t full_data = 0;
-    
-    // Add type byte (MSB)
-    full_data = (uint64_t)type << 72;
-    
-    // Add main 64-bit data
-    full_data |= instance->generic.data;
+    // The type byte doesn't fit above the 64-bit data, it only lives in data_2
+    uint64_t full_data = instance->generic.data;
     
     // Add check byte (LSB)
     full_data |= (uint64_t)check;
@@ -160,7 +164,7 @@ SubGhzProtocolStatus subghz_protocol_encoder_vw_deserialize(void *context, Flipp
 
         // Parse hex key (64 bits)
         uint64_t key = 0;
-        if (sscanf(furi_string_get_cstr(temp_str), "%016llX", &key) != 1)
+        if (sscanf(furi_string_get_cstr(temp_str), "%016" SCNx64, &key) != 1)
         {
             FURI_LOG_E(TAG, "Failed to parse Key");
             furi_string_free(temp_str);
@@ -230,13 +234,13 @@ LevelDuration subghz_protocol_encoder_vw_yield(void *context)
         if (is_high)
         {
             is_high = false;
-            return level_duration_make(true, subghz_protocol_vw_const.te_short);
+            return level_duration_make(true, vw_protocol_const.te_short);
         }
         else
         {
             is_high = true;
             preamble_count++;
-            return level_duration_make(false, subghz_protocol_vw_const.te_short);
+            return level_duration_make(false, vw_protocol_const.te_short);
         }
     }
 
@@ -244,37 +248,35 @@ LevelDuration subghz_protocol_encoder_vw_yield(void *context)
     if (sync_step == 0)
     {
         sync_step++;
-        return level_duration_make(true, subghz_protocol_vw_const.te_long);
+        return level_duration_make(true, vw_protocol_const.te_long);
     }
     else if (sync_step == 1)
     {
         sync_step++;
-        return level_duration_make(false, subghz_protocol_vw_const.te_short);
+        return level_duration_make(false, vw_protocol_const.te_short);
     }
     else if (sync_step == 2)
     {
         sync_step++;
-        return level_duration_make(true, subghz_protocol_vw_const.te_med);
+        return level_duration_make(true, VW_TE_MED);
     }
     else if (sync_step == 3)
     {
         sync_step++;
-        return level_duration_make(false, subghz_protocol_vw_const.te_med);
+        return level_duration_make(false, VW_TE_MED);
     }
     else if (sync_step == 4)
     {
         sync_step++;
         bit_index = 0;
         is_high = true;
-        return level_duration_make(true, subghz_protocol_vw_const.te_short);
+        return level_duration_make(true, vw_protocol_const.te_short);
     }
 
     // Send data bits (Manchester encoding)
     if (bit_index < instance->generic.data_count_bit)
     {
         // Extract the current bit from the 80-bit data
-        uint8_t byte_index = bit_index / 8;
-        uint8_t bit_in_byte = 7 - (bit_index % 8);
         bool current_bit;
         
         if (bit_index < 72)
@@ -294,7 +296,7 @@ LevelDuration subghz_protocol_encoder_vw_yield(void *context)
         {
             is_high = false;
             // Manchester encoding: 1 = short high, 0 = long high
-            uint32_t duration = current_bit ? subghz_protocol_vw_const.te_short : subghz_protocol_vw_const.te_long;
+            uint32_t duration = current_bit ? vw_protocol_const.te_short : vw_protocol_const.te_long;
             return level_duration_make(true, duration);
         }
         else
@@ -302,7 +304,7 @@ LevelDuration subghz_protocol_encoder_vw_yield(void *context)
             is_high = true;
             bit_index++;
             // LOW pulse duration matches the previous HIGH duration
-            uint32_t duration = current_bit ? subghz_protocol_vw_const.te_short : subghz_protocol_vw_const.te_long;
+            uint32_t duration = current_bit ? vw_protocol_const.te_short : vw_protocol_const.te_long;
             
             if (bit_index >= instance->generic.data_count_bit)
             {
@@ -441,12 +443,12 @@ static uint8_t vw_get_bit_index(uint8_t bit)
 
 static void vw_add_bit(SubGhzProtocolDecoderVw *instance, bool level)
 {
-    if (instance->generic.data_count_bit >= subghz_protocol_vw_const.min_count_bit_for_found)
+    if (instance->generic.data_count_bit >= vw_protocol_const.min_count_bit_for_found)
     {
         return;
     }
 
-    uint8_t bit_index_full = subghz_protocol_vw_const.min_count_bit_for_found - 1 - instance->generic.data_count_bit;
+    uint8_t bit_index_full = vw_protocol_const.min_count_bit_for_found - 1 - instance->generic.data_count_bit;
     uint8_t bit_index_masked = vw_get_bit_index(bit_index_full);
     uint8_t bit_index = bit_index_masked & 0x7F;
 
@@ -477,8 +479,9 @@ static void vw_add_bit(SubGhzProtocolDecoderVw *instance, bool level)
 
     instance->generic.data_count_bit++;
 
-    if (instance->generic.data_count_bit >= subghz_protocol_vw_const.min_count_bit_for_found)
+    if (instance->generic.data_count_bit >= vw_protocol_const.min_count_bit_for_found)
     {
+        instance->stats.frames++;
         if (instance->base.callback)
         {
             instance->base.callback(&instance->base, instance->base.context);
@@ -517,10 +520,11 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
 {
     furi_assert(context);
     SubGhzProtocolDecoderVw *instance = context;
+    instance->stats.pulses++;
 
-    uint32_t te_short = subghz_protocol_vw_const.te_short;
-    uint32_t te_long = subghz_protocol_vw_const.te_long;
-    uint32_t te_delta = subghz_protocol_vw_const.te_delta;
+    uint32_t te_short = vw_protocol_const.te_short;
+    uint32_t te_long = vw_protocol_const.te_long;
+    uint32_t te_delta = vw_protocol_const.te_delta;
     uint32_t te_med = (te_long + te_short) / 2;
     uint32_t te_end = te_long * 5;
 
@@ -531,6 +535,7 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
     case VwDecoderStepReset:
         if (DURATION_DIFF(duration, te_short) < te_delta)
         {
+            instance->stats.preamble_starts++;
             instance->decoder.parser_step = VwDecoderStepFoundSync;
         }
         break;
@@ -548,6 +553,7 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
             break;
         }
 
+        instance->stats.preamble_aborts++;
         instance->decoder.parser_step = VwDecoderStepReset;
         break;
 
@@ -558,6 +564,7 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
             break;
         }
 
+        instance->stats.preamble_aborts++;
         instance->decoder.parser_step = VwDecoderStepReset;
         break;
 
@@ -568,6 +575,7 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
             break;
         }
 
+        instance->stats.preamble_aborts++;
         instance->decoder.parser_step = VwDecoderStepReset;
         break;
 
@@ -598,6 +606,7 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
             break;
         }
 
+        instance->stats.preamble_aborts++;
         instance->decoder.parser_step = VwDecoderStepReset;
         break;
 
@@ -613,7 +622,7 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
         }
 
         // Last bit can be arbitrarily long
-        if (instance->generic.data_count_bit == subghz_protocol_vw_const.min_count_bit_for_found - 1 &&
+        if (instance->generic.data_count_bit == vw_protocol_const.min_count_bit_for_found - 1 &&
             !level && duration > te_end)
         {
             event = ManchesterEventShortLow;
@@ -621,6 +630,11 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
 
         if (event == ManchesterEventReset)
         {
+            // Frame done (count reached) or cut short
+            if (instance->generic.data_count_bit < vw_protocol_const.min_count_bit_for_found)
+            {
+                instance->stats.bit_mismatches++;
+            }
             subghz_protocol_decoder_vw_reset(instance);
         }
         else
@@ -634,6 +648,11 @@ void subghz_protocol_decoder_vw_feed(void *context, bool level, uint32_t duratio
             {
                 vw_add_bit(instance, new_level);
             }
+            // Frame handed out, look for the next repeat's preamble right away
+            if (instance->generic.data_count_bit >= vw_protocol_const.min_count_bit_for_found)
+            {
+                subghz_protocol_decoder_vw_reset(instance);
+            }
         }
         break;
     }
@@ -679,7 +698,7 @@ SubGhzProtocolStatus subghz_protocol_decoder_vw_deserialize(void *context, Flipp
     furi_assert(context);
     SubGhzProtocolDecoderVw *instance = context;
     return subghz_block_generic_deserialize_check_count_bit(
-        &instance->generic, flipper_format, subghz_protocol_vw_const.min_count_bit_for_found);
+        &instance->generic, flipper_format, vw_protocol_const.min_count_bit_for_found);
 }
 
 static const char *vw_get_button_name(uint8_t btn)
@@ -722,7 +741,7 @@ void subghz_protocol_decoder_vw_get_string(void *context, FuriString *output)
     furi_string_cat_printf(
         output,
         "%s %dbit\r\n"
-        "Key:%02X%08lX%08lX%02X\r\n"
+        "Key:%02X%08" PRIX32 "%08" PRIX32 "%02X\r\n"
         "Type:%02X Btn:%X %s\r\n",
         instance->generic.protocol_name,
         instance->generic.data_count_bit,
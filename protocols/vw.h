@@ -14,6 +14,7 @@
 #define VW_PROTOCOL_NAME "VW"
 
 extern const SubGhzProtocol vw_protocol;
+extern const SubGhzBlockConst vw_protocol_const;
 
 void* subghz_protocol_decoder_vw_alloc(SubGhzEnvironment* environment);
 void subghz_protocol_decoder_vw_free(void* context);
@@ -3,7 +3,6 @@
 
 #include <furi.h>
 #include <furi_hal.h>
-#include "protocols/protocol_items.h"
 
 #define TAG "ProtoPirateApp"
 
@@ -89,6 +88,15 @@ ProtoPirateApp *protopirate_app_alloc()
         ProtoPirateViewReceiverInfo,
         protopirate_view_receiver_info_get_view(app->protopirate_receiver_info));
 
+    // Waterfall
+    app->protopirate_waterfall = protopirate_view_waterfall_alloc();
+    view_dispatcher_add_view(
+        app->view_dispatcher,
+        ProtoPirateViewWaterfall,
+        protopirate_view_waterfall_get_view(app->protopirate_waterfall));
+    app->waterfall_sequence = 0;
+    app->waterfall_epoch = 0;
+
     // Init setting
     app->setting = subghz_setting_alloc();
     app->loaded_file_path = NULL;
@@ -108,17 +116,38 @@ ProtoPirateApp *protopirate_app_alloc()
     app->txrx->hopper_state = ProtoPirateHopperStateOFF;
     app->txrx->hopper_idx_frequency = 0;
     app->txrx->hopper_timeout = 0;
+    app->txrx->hopper_dwell = 0;
+    app->txrx->hopper_dwell_ms = PROTOPIRATE_HOPPER_DWELL_MS;
+    app->txrx->hopper_thread = NULL;
+    app->txrx->hopper_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    app->txrx->rssi = -127.0f;
+    app->txrx->hopper_decode_hit = false;
+    app->txrx->waterfall = protopirate_waterfall_alloc();
+    app->txrx->waterfall_samples = 0;
+    app->txrx->hopper_scan_modulation = false;
+    app->txrx->scan_plan.step_count = 0;
     app->txrx->idx_menu_chosen = 0;
+    protopirate_hopper_stats_reset(
+        &app->txrx->hopper_stats, subghz_setting_get_hopper_frequency_count(app->setting));
 
     app->txrx->history = protopirate_history_alloc();
     app->txrx->worker = subghz_worker_alloc();
+    app->txrx->flight_recorder = protopirate_flight_recorder_alloc();
+
+    app->latency = protopirate_latency_alloc();
+    protopirate_view_receiver_set_latency(app->protopirate_receiver, app->latency);
+
+    // Decoders look the trace ring up when they are allocated
+    app->trace = protopirate_trace_alloc();
 
-    // Create environment with our custom protocols
+    // Create environment, protocols are loaded once the receiver knows what it listens to
+    app->txrx->protocol_loader = protopirate_protocol_loader_alloc();
     app->txrx->environment = subghz_environment_alloc();
 
-    FURI_LOG_I(TAG, "Registering %zu ProtoPirate protocols", protopirate_protocol_registry.size);
+    FURI_LOG_I(TAG, "%zu ProtoPirate protocols available", protopirate_protocol_manifest_count);
     subghz_environment_set_protocol_registry(
-        app->txrx->environment, (void *)&protopirate_protocol_registry);
+        app->txrx->environment,
+        (void *)protopirate_protocol_loader_get_registry(app->txrx->protocol_loader));
 
     // Create receiver
     app->txrx->receiver = subghz_receiver_alloc_init(app->txrx->environment);
@@ -126,9 +155,18 @@ ProtoPirateApp *protopirate_app_alloc()
     // Initialize SubGhz devices
     subghz_devices_init();
 
-    // Try external CC1101 first, fallback to internal
-    app->txrx->radio_device = 
-        radio_device_loader_set(NULL, SubGhzRadioDeviceTypeExternalCC1101);
+    // A sim script on the SD card replaces the radio for hardware-free runs,
+    // otherwise try external CC1101 first, fallback to internal
+    app->txrx->radio_device = NULL;
+    if(protopirate_sim_device_is_available()) {
+        FURI_LOG_W(TAG, "Sim script found, using simulated radio.");
+        app->txrx->radio_device =
+            radio_device_loader_set(NULL, SubGhzRadioDeviceTypeSimulated);
+    }
+    if(!app->txrx->radio_device) {
+        app->txrx->radio_device =
+            radio_device_loader_set(NULL, SubGhzRadioDeviceTypeExternalCC1101);
+    }
 
     if(!app->txrx->radio_device) {
         FURI_LOG_W(TAG, "External CC1101 not found, using internal CC1101.");
@@ -153,15 +191,15 @@ ProtoPirateApp *protopirate_app_alloc()
     subghz_devices_reset(app->txrx->radio_device);
     subghz_devices_idle(app->txrx->radio_device);
 
-    // Set filter to accept decodable protocols
-    subghz_receiver_set_filter(app->txrx->receiver, SubGhzProtocolFlag_Decodable);
+    // Worker feeds only the decoders that match the current preset
+    app->txrx->decoders = protopirate_decoders_alloc(
+        app->txrx->receiver, protopirate_protocol_loader_get_registry(app->txrx->protocol_loader));
 
     // Set up worker callbacks
-    subghz_worker_set_overrun_callback(
-        app->txrx->worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
-    subghz_worker_set_pair_callback(
-        app->txrx->worker, (SubGhzWorkerPairCallback)subghz_receiver_decode);
-    subghz_worker_set_context(app->txrx->worker, app->txrx->receiver);
+    subghz_worker_set_overrun_callback(app->txrx->worker, protopirate_decoders_overrun);
+    subghz_worker_set_pair_callback(app->txrx->worker, protopirate_decoders_feed);
+    subghz_worker_set_context(app->txrx->worker, app->txrx->decoders);
+    protopirate_set_glitch_filter(app, PROTOPIRATE_GLITCH_FILTER_US);
 
     furi_hal_power_suppress_charge_enter();
 
@@ -177,6 +215,7 @@ void protopirate_app_free(ProtoPirateApp *app)
     FURI_LOG_I(TAG, "Freeing ProtoPirate Decoder App");
 
     // Make sure we're not receiving
+    protopirate_hopper_stop(app);
     if (app->txrx->txrx_state == ProtoPirateTxRxStateRx)
     {
         subghz_worker_stop(app->txrx->worker);
@@ -217,14 +256,28 @@ void protopirate_app_free(ProtoPirateApp *app)
     view_dispatcher_remove_view(app->view_dispatcher, ProtoPirateViewReceiverInfo);
     protopirate_view_receiver_info_free(app->protopirate_receiver_info);
 
+    // Waterfall
+    view_dispatcher_remove_view(app->view_dispatcher, ProtoPirateViewWaterfall);
+    protopirate_view_waterfall_free(app->protopirate_waterfall);
+
     // Setting
     subghz_setting_free(app->setting);
 
+    // The receiver view that pointed at it is gone
+    protopirate_latency_free(app->latency);
+
     // Worker & Protocol & History
+    protopirate_decoders_free(app->txrx->decoders);
     subghz_receiver_free(app->txrx->receiver);
     subghz_environment_free(app->txrx->environment);
+    protopirate_protocol_loader_free(app->txrx->protocol_loader);
     protopirate_history_free(app->txrx->history);
     subghz_worker_free(app->txrx->worker);
+    protopirate_flight_recorder_free(app->txrx->flight_recorder);
+    furi_mutex_free(app->txrx->hopper_mutex);
+    protopirate_waterfall_free(app->txrx->waterfall);
+    // After the decoders, they hold the ring
+    protopirate_trace_free(app->trace);
     furi_string_free(app->txrx->preset->name);
     free(app->txrx->preset);
     free(app->txrx);
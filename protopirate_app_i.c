@@ -50,22 +50,28 @@ bool protopirate_set_preset(ProtoPirateApp *app, const char *preset)
 
 void protopirate_get_frequency_modulation(
     ProtoPirateApp *app,
-    FuriString *frequency,
-    FuriString *modulation)
+    char *frequency,
+    size_t frequency_size,
+    char *modulation,
+    size_t modulation_size)
 {
     furi_assert(app);
+    furi_check(furi_mutex_acquire(app->txrx->hopper_mutex, FuriWaitForever) == FuriStatusOk);
     if (frequency != NULL)
     {
-        furi_string_printf(
+        snprintf(
             frequency,
+            frequency_size,
             "%03ld.%02ld",
             app->txrx->preset->frequency / 1000000 % 1000,
             app->txrx->preset->frequency / 10000 % 100);
     }
     if (modulation != NULL)
     {
-        furi_string_printf(modulation, "%.2s", furi_string_get_cstr(app->txrx->preset->name));
+        snprintf(
+            modulation, modulation_size, "%.2s", furi_string_get_cstr(app->txrx->preset->name));
     }
+    furi_mutex_release(app->txrx->hopper_mutex);
 }
 
 void protopirate_begin(ProtoPirateApp *app, uint8_t *preset_data)
@@ -77,6 +83,15 @@ void protopirate_begin(ProtoPirateApp *app, uint8_t *preset_data)
     app->txrx->txrx_state = ProtoPirateTxRxStateIDLE;
 }
 
+// Radio ISR, tells the decoders how much signal the worker has to catch up on
+static void protopirate_rx_callback(bool level, uint32_t duration, void *context)
+{
+    ProtoPirateTxRx *txrx = context;
+    protopirate_decoders_count_rx(txrx->decoders, duration);
+    protopirate_flight_recorder_add(txrx->flight_recorder, level, duration);
+    subghz_worker_rx_callback(level, duration, txrx->worker);
+}
+
 uint32_t protopirate_rx(ProtoPirateApp *app, uint32_t frequency)
 {
     furi_assert(app);
@@ -93,8 +108,11 @@ uint32_t protopirate_rx(ProtoPirateApp *app, uint32_t frequency)
     subghz_devices_flush_rx(app->txrx->radio_device);
     subghz_devices_set_rx(app->txrx->radio_device);
 
-    subghz_devices_start_async_rx(
-        app->txrx->radio_device, subghz_worker_rx_callback, app->txrx->worker);
+    // Worker is stopped here, safe to swap the decoder set
+    protopirate_decoders_select(
+        app->txrx->decoders, furi_string_get_cstr(app->txrx->preset->name), frequency);
+
+    subghz_devices_start_async_rx(app->txrx->radio_device, protopirate_rx_callback, app->txrx);
 
     subghz_worker_start(app->txrx->worker);
     app->txrx->txrx_state = ProtoPirateTxRxStateRx;
@@ -129,35 +147,138 @@ void protopirate_sleep(ProtoPirateApp *app)
     app->txrx->txrx_state = ProtoPirateTxRxStateSleep;
 }
 
-void protopirate_hopper_update(ProtoPirateApp *app)
+typedef enum
+{
+    ProtoPirateHopperThreadFlagStop = (1 << 0),
+} ProtoPirateHopperThreadFlag;
+
+// Point the preset at the current plan step, true if the preset changed
+static bool protopirate_hopper_apply_step(ProtoPirateApp *app)
+{
+    const ProtoPirateScanStep *step =
+        protopirate_scan_plan_get_step(&app->txrx->scan_plan, app->txrx->hopper_idx_frequency);
+    app->txrx->preset->frequency = step->frequency;
+
+    if (step->preset_index == PROTOPIRATE_SCAN_PRESET_KEEP)
+    {
+        return false;
+    }
+    const char *preset_name = subghz_setting_get_preset_name(app->setting, step->preset_index);
+    if (!strcmp(furi_string_get_cstr(app->txrx->preset->name), preset_name))
+    {
+        return false;
+    }
+    protopirate_preset_init(
+        app,
+        preset_name,
+        step->frequency,
+        subghz_setting_get_preset_data(app->setting, step->preset_index),
+        subghz_setting_get_preset_data_size(app->setting, step->preset_index));
+    return true;
+}
+
+void protopirate_hopper_prepare(ProtoPirateApp *app)
 {
     furi_assert(app);
+    if (protopirate_scan_plan_build(
+            &app->txrx->scan_plan, app->setting, app->txrx->hopper_scan_modulation))
+    {
+        // Stats are per plan step, a new plan starts from scratch
+        protopirate_hopper_stats_reset(&app->txrx->hopper_stats, app->txrx->scan_plan.step_count);
+        protopirate_waterfall_reset(app->txrx->waterfall, app->txrx->scan_plan.step_count);
+    }
+    if (app->txrx->scan_plan.step_count == 0)
+    {
+        FURI_LOG_W(TAG, "No hopper frequencies, hopping disabled");
+        app->txrx->hopper_state = ProtoPirateHopperStateOFF;
+        return;
+    }
+
+    app->txrx->hopper_idx_frequency = 0;
+    protopirate_hopper_apply_step(app);
+    app->txrx->hopper_dwell = protopirate_hopper_stats_enter(&app->txrx->hopper_stats, 0) *
+                              app->txrx->hopper_dwell_ms / PROTOPIRATE_HOPPER_SAMPLE_MS;
+}
+
+static void protopirate_hopper_waterfall_add(ProtoPirateApp *app)
+{
+    if (app->txrx->hopper_state != ProtoPirateHopperStateOFF)
+    {
+        // Row per plan step, the column closes when the plan wraps
+        protopirate_waterfall_add_rssi(
+            app->txrx->waterfall, app->txrx->hopper_idx_frequency, app->txrx->rssi);
+        return;
+    }
+
+    protopirate_waterfall_add_rssi(app->txrx->waterfall, 0, app->txrx->rssi);
+    if (++app->txrx->waterfall_samples >=
+        PROTOPIRATE_WATERFALL_COLUMN_MS / PROTOPIRATE_HOPPER_SAMPLE_MS)
+    {
+        app->txrx->waterfall_samples = 0;
+        protopirate_waterfall_commit(app->txrx->waterfall);
+    }
+}
+
+// Advance the hopper state under hopper_mutex, true if the radio has to move to the new step.
+// reload is set when the step also changes modulation.
+static bool protopirate_hopper_step(ProtoPirateApp *app, bool *reload)
+{
+    const uint16_t hold = PROTOPIRATE_HOPPER_HOLD_MS / PROTOPIRATE_HOPPER_SAMPLE_MS;
+
+    if (app->txrx->txrx_state == ProtoPirateTxRxStateRx)
+    {
+        app->txrx->rssi = subghz_devices_get_rssi(app->txrx->radio_device);
+        protopirate_hopper_waterfall_add(app);
+    }
+
+    if (app->txrx->hopper_decode_hit)
+    {
+        app->txrx->hopper_decode_hit = false;
+        if (app->txrx->hopper_state != ProtoPirateHopperStateOFF)
+        {
+            // Credit the channel and hold on it for a while
+            protopirate_hopper_stats_add_decode(
+                &app->txrx->hopper_stats, app->txrx->hopper_idx_frequency, furi_get_tick());
+            app->txrx->hopper_timeout = hold;
+            app->txrx->hopper_state = ProtoPirateHopperStateRSSITimeOut;
+        }
+    }
 
     switch (app->txrx->hopper_state)
     {
     case ProtoPirateHopperStateOFF:
     case ProtoPirateHopperStatePause:
-        return;
+        return false;
     case ProtoPirateHopperStateRSSITimeOut:
         if (app->txrx->hopper_timeout != 0)
         {
             app->txrx->hopper_timeout--;
-            return;
+            return false;
         }
         break;
     default:
         break;
     }
-    float rssi = -127.0f;
+
     if (app->txrx->hopper_state != ProtoPirateHopperStateRSSITimeOut)
     {
-        rssi = subghz_devices_get_rssi(app->txrx->radio_device);
-
-        if (rssi > -90.0f)
+        // Hold on any channel that stands out of its own noise floor
+        if (protopirate_hopper_stats_add_rssi(
+                &app->txrx->hopper_stats,
+                app->txrx->hopper_idx_frequency,
+                app->txrx->rssi,
+                furi_get_tick()))
         {
-            app->txrx->hopper_timeout = 10;
+            app->txrx->hopper_timeout = hold;
             app->txrx->hopper_state = ProtoPirateHopperStateRSSITimeOut;
-            return;
+            return false;
+        }
+
+        // Busy channels get a longer dwell
+        if (app->txrx->hopper_dwell > 1)
+        {
+            app->txrx->hopper_dwell--;
+            return false;
         }
     }
     else
@@ -165,27 +286,244 @@ void protopirate_hopper_update(ProtoPirateApp *app)
         app->txrx->hopper_state = ProtoPirateHopperStateRunning;
     }
 
-    if (app->txrx->hopper_idx_frequency <
-        subghz_setting_get_hopper_frequency_count(app->setting) - 1)
+    uint8_t step_count = app->txrx->scan_plan.step_count;
+    if (step_count == 0)
+    {
+        return false;
+    }
+    if (app->txrx->hopper_idx_frequency < step_count - 1)
     {
         app->txrx->hopper_idx_frequency++;
     }
     else
     {
         app->txrx->hopper_idx_frequency = 0;
+        protopirate_waterfall_commit(app->txrx->waterfall);
     }
+    app->txrx->hopper_dwell =
+        protopirate_hopper_stats_enter(&app->txrx->hopper_stats, app->txrx->hopper_idx_frequency) *
+        app->txrx->hopper_dwell_ms / PROTOPIRATE_HOPPER_SAMPLE_MS;
 
+    if (app->txrx->txrx_state != ProtoPirateTxRxStateRx &&
+        app->txrx->txrx_state != ProtoPirateTxRxStateIDLE)
+    {
+        return false;
+    }
+    // Only reload the radio when the step changes modulation
+    *reload = protopirate_hopper_apply_step(app);
+    return true;
+}
+
+// Move the radio to the current step. Joins the worker, so it must run without hopper_mutex:
+// the worker callback can block on the view dispatcher while the UI waits on the mutex.
+static void protopirate_hopper_retune(ProtoPirateApp *app, bool reload)
+{
     if (app->txrx->txrx_state == ProtoPirateTxRxStateRx)
     {
         protopirate_rx_end(app);
     }
-    if (app->txrx->txrx_state == ProtoPirateTxRxStateIDLE)
+    subghz_receiver_reset(app->txrx->receiver);
+    if (reload)
+    {
+        protopirate_begin(app, app->txrx->preset->data);
+    }
+    protopirate_rx(app, app->txrx->preset->frequency);
+}
+
+void protopirate_hopper_update(ProtoPirateApp *app)
+{
+    furi_assert(app);
+    bool reload = false;
+    if (protopirate_hopper_step(app, &reload))
     {
-        subghz_receiver_reset(app->txrx->receiver);
-        app->txrx->preset->frequency =
-            subghz_setting_get_hopper_frequency(app->setting, app->txrx->hopper_idx_frequency);
-        protopirate_rx(app, app->txrx->preset->frequency);
+        protopirate_hopper_retune(app, reload);
+    }
+}
+
+static int32_t protopirate_hopper_thread(void *context)
+{
+    ProtoPirateApp *app = context;
+    const uint32_t period = furi_ms_to_ticks(PROTOPIRATE_HOPPER_SAMPLE_MS);
+    uint32_t deadline = furi_get_tick();
+
+    while (true)
+    {
+        bool reload = false;
+        furi_check(furi_mutex_acquire(app->txrx->hopper_mutex, FuriWaitForever) == FuriStatusOk);
+        bool retune = protopirate_hopper_step(app, &reload);
+        furi_mutex_release(app->txrx->hopper_mutex);
+        // Only the hopper thread touches the preset while it runs, no lock needed to read it
+        if (retune)
+        {
+            protopirate_hopper_retune(app, reload);
+        }
+
+        // Fixed-rate schedule: the next slot doesn't move when a hop takes long
+        deadline += period;
+        int32_t timeout = (int32_t)(deadline - furi_get_tick());
+        if (timeout <= 0)
+        {
+            deadline = furi_get_tick();
+            timeout = 0;
+        }
+        uint32_t flags = furi_thread_flags_wait(
+            ProtoPirateHopperThreadFlagStop, FuriFlagWaitAny, (uint32_t)timeout);
+        if (!(flags & FuriFlagError) && (flags & ProtoPirateHopperThreadFlagStop))
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+void protopirate_hopper_start(ProtoPirateApp *app)
+{
+    furi_assert(app);
+    furi_assert(!app->txrx->hopper_thread);
+
+    app->txrx->hopper_decode_hit = false;
+    // Fixed frequency keeps a single waterfall row
+    if (app->txrx->hopper_state == ProtoPirateHopperStateOFF)
+    {
+        protopirate_waterfall_set_row_count(app->txrx->waterfall, 1);
+    }
+    else
+    {
+        protopirate_waterfall_set_row_count(
+            app->txrx->waterfall, app->txrx->scan_plan.step_count);
+    }
+    app->txrx->waterfall_samples = 0;
+    app->txrx->hopper_thread =
+        furi_thread_alloc_ex("ProtoPirateHopper", 2048, protopirate_hopper_thread, app);
+    furi_thread_set_priority(app->txrx->hopper_thread, FuriThreadPriorityHigh);
+    furi_thread_start(app->txrx->hopper_thread);
+}
+
+void protopirate_hopper_stop(ProtoPirateApp *app)
+{
+    furi_assert(app);
+    if (!app->txrx->hopper_thread)
+    {
+        return;
+    }
+
+    furi_thread_flags_set(
+        furi_thread_get_id(app->txrx->hopper_thread), ProtoPirateHopperThreadFlagStop);
+    furi_thread_join(app->txrx->hopper_thread);
+    furi_thread_free(app->txrx->hopper_thread);
+    app->txrx->hopper_thread = NULL;
+}
+
+float protopirate_hopper_get_rssi(ProtoPirateApp *app)
+{
+    furi_assert(app);
+    furi_check(furi_mutex_acquire(app->txrx->hopper_mutex, FuriWaitForever) == FuriStatusOk);
+    float rssi = app->txrx->rssi;
+    furi_mutex_release(app->txrx->hopper_mutex);
+    return rssi;
+}
+
+// Rebuild the receiver around a new protocol set, the worker must be stopped
+static void protopirate_protocols_load(ProtoPirateApp *app, uint32_t mask)
+{
+    ProtoPirateTxRx *txrx = app->txrx;
+    // A missing plugin stays missing, don't rebuild the receiver to retry it
+    mask &= ~protopirate_protocol_loader_get_failed(txrx->protocol_loader);
+    if (mask == protopirate_protocol_loader_get_loaded(txrx->protocol_loader))
+    {
+        return;
+    }
+    furi_assert(txrx->txrx_state != ProtoPirateTxRxStateRx);
+
+    // Decoder instances point into the protocols, drop them before unloading
+    protopirate_decoders_free(txrx->decoders);
+    subghz_receiver_free(txrx->receiver);
+
+    protopirate_protocol_loader_load(txrx->protocol_loader, mask);
+    const SubGhzProtocolRegistry *registry =
+        protopirate_protocol_loader_get_registry(txrx->protocol_loader);
+    subghz_environment_set_protocol_registry(txrx->environment, (void *)registry);
+
+    txrx->receiver = subghz_receiver_alloc_init(txrx->environment);
+    txrx->decoders = protopirate_decoders_alloc(txrx->receiver, registry);
+    protopirate_decoders_set_glitch_filter(txrx->decoders, txrx->glitch_filter_us);
+    subghz_worker_set_context(txrx->worker, txrx->decoders);
+}
+
+void protopirate_set_glitch_filter(ProtoPirateApp *app, uint16_t filter_us)
+{
+    furi_assert(app);
+    // The worker merges shorter pulses and folds same-level runs before the
+    // pair callback, so decoders never see a pulse split by a glitch
+    app->txrx->glitch_filter_us = filter_us;
+    subghz_worker_set_filter(app->txrx->worker, filter_us);
+    protopirate_decoders_set_glitch_filter(app->txrx->decoders, filter_us);
+}
+
+void protopirate_protocols_load_for_rx(ProtoPirateApp *app)
+{
+    furi_assert(app);
+    const char *preset_name = furi_string_get_cstr(app->txrx->preset->name);
+    uint32_t mask = 0;
+
+    // Every protocol that can decode on at least one frequency/preset we'll listen on
+    for (size_t i = 0; i < protopirate_protocol_manifest_count; i++)
+    {
+        SubGhzProtocolFlag flag = protopirate_protocol_manifest[i].flag;
+        if (!(flag & SubGhzProtocolFlag_Decodable))
+        {
+            continue;
+        }
+
+        if (app->txrx->hopper_state == ProtoPirateHopperStateOFF)
+        {
+            if (protopirate_decoders_match(flag, preset_name, app->txrx->preset->frequency))
+            {
+                mask |= 1UL << i;
+            }
+            continue;
+        }
+        for (uint8_t s = 0; s < app->txrx->scan_plan.step_count; s++)
+        {
+            const ProtoPirateScanStep *step = &app->txrx->scan_plan.step[s];
+            const char *step_preset =
+                step->preset_index == PROTOPIRATE_SCAN_PRESET_KEEP ?
+                    preset_name :
+                    subghz_setting_get_preset_name(app->setting, step->preset_index);
+            if (protopirate_decoders_match(flag, step_preset, step->frequency))
+            {
+                mask |= 1UL << i;
+                break;
+            }
+        }
+    }
+
+    protopirate_protocols_load(app, mask);
+}
+
+const SubGhzProtocol *protopirate_protocols_require(ProtoPirateApp *app, const char *name)
+{
+    furi_assert(app);
+    int32_t index = protopirate_protocol_manifest_find(name);
+    if (index < 0)
+    {
+        return NULL;
+    }
+
+    protopirate_protocols_load(
+        app, protopirate_protocol_loader_get_loaded(app->txrx->protocol_loader) | (1UL << index));
+
+    const SubGhzProtocolRegistry *registry =
+        protopirate_protocol_loader_get_registry(app->txrx->protocol_loader);
+    for (size_t i = 0; i < registry->size; i++)
+    {
+        if (!strcmp(registry->items[i]->name, name))
+        {
+            return registry->items[i];
+        }
     }
+    return NULL;
 }
 
 void protopirate_tx(ProtoPirateApp *app, uint32_t frequency)
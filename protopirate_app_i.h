@@ -5,8 +5,18 @@
 #include "scenes/protopirate_scene.h"
 #include "views/protopirate_receiver.h"
 #include "views/protopirate_receiver_info.h"
+#include "views/protopirate_waterfall.h"
 #include "protopirate_history.h"
 #include "helpers/radio_device_loader.h"
+#include "helpers/protopirate_sim_device.h"
+#include "helpers/protopirate_hopper_stats.h"
+#include "helpers/protopirate_scan_plan.h"
+#include "helpers/protopirate_decoders.h"
+#include "helpers/protopirate_flight_recorder.h"
+#include "helpers/protopirate_latency.h"
+#include "helpers/protopirate_trace.h"
+#include "helpers/protopirate_waterfall.h"
+#include "helpers/protopirate_protocol_loader.h"
 
 #include <gui/gui.h>
 #include <gui/view_dispatcher.h>
@@ -21,21 +31,50 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/devices/devices.h>
 
+#define PROTOPIRATE_HOPPER_SAMPLE_MS   10
+#define PROTOPIRATE_HOPPER_HOLD_MS     1000
+#define PROTOPIRATE_HOPPER_DWELL_MS    100
+#define PROTOPIRATE_HOPPER_DWELL_MS_MIN PROTOPIRATE_HOPPER_SAMPLE_MS
+// Pulses shorter than this are merged into their neighbours, the worker's default
+#define PROTOPIRATE_GLITCH_FILTER_US 30
+// Waterfall column length when not hopping, a hopping column is one plan sweep
+#define PROTOPIRATE_WATERFALL_COLUMN_MS 100
+
 typedef struct ProtoPirateApp ProtoPirateApp;
 
 typedef struct
 {
     SubGhzWorker *worker;
     SubGhzEnvironment *environment;
+    ProtoPirateProtocolLoader *protocol_loader;
     SubGhzReceiver *receiver;
+    ProtoPirateDecoders *decoders;
+    // Raw pulses ahead of the worker, dumped to the SD on triggers
+    ProtoPirateFlightRecorder *flight_recorder;
+    uint16_t glitch_filter_us;
     SubGhzRadioPreset *preset;
     ProtoPirateHistory *history;
     const SubGhzDevice *radio_device;
     ProtoPirateTxRxState txrx_state;
     ProtoPirateHopperState hopper_state;
     ProtoPirateRxKeyState rx_key_state;
+    // Current step of scan_plan
     uint8_t hopper_idx_frequency;
-    uint8_t hopper_timeout;
+    uint16_t hopper_timeout;
+    uint16_t hopper_dwell;
+    uint16_t hopper_dwell_ms;
+    ProtoPirateHopperStats hopper_stats;
+    ProtoPirateScanPlan scan_plan;
+    bool hopper_scan_modulation;
+    // Hopper thread owns the radio while running, the UI reads under the mutex.
+    // The mutex is never held across a retune, that joins the worker thread
+    FuriThread *hopper_thread;
+    FuriMutex *hopper_mutex;
+    float rssi;
+    ProtoPirateWaterfall *waterfall;
+    uint16_t waterfall_samples;
+    // Set from the worker thread, consumed by the hopper thread
+    volatile bool hopper_decode_hit;
     uint16_t idx_menu_chosen;
 } ProtoPirateTxRx;
 
@@ -51,7 +90,17 @@ struct ProtoPirateApp
     View *view_about;
     ProtoPirateReceiver *protopirate_receiver;
     ProtoPirateReceiverInfo *protopirate_receiver_info;
+    ProtoPirateWaterfallView *protopirate_waterfall;
+    // Last waterfall column and layout handed to the view
+    uint32_t waterfall_sequence;
+    uint8_t waterfall_epoch;
+    // Decoder fail count at the last receiver tick, a rise triggers the flight recorder
+    uint32_t flight_fails;
     ProtoPirateTxRx *txrx;
+    // Decode-to-screen timing of received frames
+    ProtoPirateLatency *latency;
+    // Binary event ring shared with the decoders
+    ProtoPirateTrace *trace;
     SubGhzSetting *setting;
     ProtoPirateLock lock;
     FuriString *loaded_file_path;
@@ -68,14 +117,23 @@ bool protopirate_set_preset(ProtoPirateApp *app, const char *preset);
 
 void protopirate_get_frequency_modulation(
     ProtoPirateApp *app,
-    FuriString *frequency,
-    FuriString *modulation);
+    char *frequency,
+    size_t frequency_size,
+    char *modulation,
+    size_t modulation_size);
 
 void protopirate_begin(ProtoPirateApp *app, uint8_t *preset_data);
 uint32_t protopirate_rx(ProtoPirateApp *app, uint32_t frequency);
 void protopirate_idle(ProtoPirateApp *app);
 void protopirate_rx_end(ProtoPirateApp *app);
 void protopirate_sleep(ProtoPirateApp *app);
+void protopirate_hopper_prepare(ProtoPirateApp *app);
 void protopirate_hopper_update(ProtoPirateApp *app);
+void protopirate_hopper_start(ProtoPirateApp *app);
+void protopirate_hopper_stop(ProtoPirateApp *app);
+float protopirate_hopper_get_rssi(ProtoPirateApp *app);
+void protopirate_set_glitch_filter(ProtoPirateApp *app, uint16_t filter_us);
+void protopirate_protocols_load_for_rx(ProtoPirateApp *app);
+const SubGhzProtocol *protopirate_protocols_require(ProtoPirateApp *app, const char *name);
 void protopirate_tx(ProtoPirateApp *app, uint32_t frequency);
 void protopirate_tx_stop(ProtoPirateApp *app);
\ No newline at end of file
@@ -10,6 +10,11 @@ typedef struct {
     FlipperFormat* flipper_format;
     uint8_t type;
     SubGhzRadioPreset* preset;
+    ProtoPirateFrameQuality quality;
+    // What a repeat has to match, the 8-bit hash alone collides
+    const SubGhzProtocol* protocol;
+    uint64_t data;
+    uint16_t data_count_bit;
 } ProtoPirateHistoryItem;
 
 ARRAY_DEF(ProtoPirateHistoryItemArray, ProtoPirateHistoryItem, M_POD_OPLIST)
@@ -62,6 +67,14 @@ uint16_t protopirate_history_get_last_index(ProtoPirateHistory* instance) {
     return instance->last_index;
 }
 
+static bool protopirate_history_is_repeat(
+    const ProtoPirateHistoryItem* item,
+    SubGhzProtocolDecoderBase* decoder_base) {
+    const SubGhzBlockGeneric* generic = protopirate_decode_generic_get(decoder_base);
+    return item->protocol == decoder_base->protocol && item->data == generic->data &&
+           item->data_count_bit == generic->data_count_bit;
+}
+
 bool protopirate_history_add_to_history(
     ProtoPirateHistory* instance,
     void* context,
@@ -74,10 +87,22 @@ bool protopirate_history_add_to_history(
     }
 
     SubGhzProtocolDecoderBase* decoder_base = context;
+    const ProtoPirateFrameQuality* quality = &protopirate_decode_stats_get(decoder_base)->quality;
+    size_t count = ProtoPirateHistoryItemArray_size(instance->data);
+    ProtoPirateHistoryItem* last =
+        count ? ProtoPirateHistoryItemArray_get(instance->data, count - 1) : NULL;
     if((instance->code_last_hash_data ==
         subghz_protocol_decoder_base_get_hash_data(decoder_base)) &&
-       ((furi_get_tick() - instance->last_update_timestamp) < 500)) {
+       ((furi_get_tick() - instance->last_update_timestamp) < 500) && last &&
+       protopirate_history_is_repeat(last, decoder_base)) {
         instance->last_update_timestamp = furi_get_tick();
+        // A repeat of the last capture, keep whichever copy was received cleaner
+        if(quality->score > last->quality.score) {
+            stream_clean(flipper_format_get_raw_stream(last->flipper_format));
+            subghz_protocol_decoder_base_serialize(decoder_base, last->flipper_format, preset);
+            subghz_protocol_decoder_base_get_string(decoder_base, last->item_str);
+            last->quality = *quality;
+        }
         return false;
     }
 
@@ -89,6 +114,11 @@ bool protopirate_history_add_to_history(
     item->item_str = furi_string_alloc();
     item->flipper_format = flipper_format_string_alloc();
     item->type = 0;
+    item->quality = *quality;
+    const SubGhzBlockGeneric* generic = protopirate_decode_generic_get(decoder_base);
+    item->protocol = decoder_base->protocol;
+    item->data = generic->data;
+    item->data_count_bit = generic->data_count_bit;
 
     // Copy preset
     item->preset = malloc(sizeof(SubGhzRadioPreset));
@@ -162,6 +192,21 @@ void protopirate_history_get_text_item(
     furi_string_set(output, item->item_str);
 }
 
+void protopirate_history_get_quality(
+    ProtoPirateHistory* instance,
+    uint16_t idx,
+    ProtoPirateFrameQuality* quality) {
+    furi_assert(instance);
+    furi_assert(quality);
+
+    if(idx >= ProtoPirateHistoryItemArray_size(instance->data)) {
+        memset(quality, 0, sizeof(ProtoPirateFrameQuality));
+        return;
+    }
+
+    *quality = ProtoPirateHistoryItemArray_get(instance->data, idx)->quality;
+}
+
 SubGhzProtocolDecoderBase*
     protopirate_history_get_decoder_base(ProtoPirateHistory* instance, uint16_t idx) {
     UNUSED(instance);
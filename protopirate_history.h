@@ -4,6 +4,8 @@
 #include <lib/subghz/receiver.h>
 #include <lib/subghz/protocols/base.h>
 
+#include "protocols/protocol_stats.h"
+
 #define KIA_HISTORY_MAX 50
 
 typedef struct ProtoPirateHistory ProtoPirateHistory;
@@ -25,6 +27,11 @@ void protopirate_history_get_text_item(
     ProtoPirateHistory* instance,
     FuriString* output,
     uint16_t idx);
+/** Timing grade of the stored capture, all zero if its decoder doesn't grade */
+void protopirate_history_get_quality(
+    ProtoPirateHistory* instance,
+    uint16_t idx,
+    ProtoPirateFrameQuality* quality);
 SubGhzProtocolDecoderBase*
     protopirate_history_get_decoder_base(ProtoPirateHistory* instance, uint16_t idx);
 FlipperFormat* protopirate_history_get_raw_data(ProtoPirateHistory* instance, uint16_t idx);
@@ -0,0 +1,157 @@
+// scenes/protopirate_scene_decoder_stats.c
+#include "../protopirate_app_i.h"
+#include "../helpers/protopirate_storage.h"
+
+static void protopirate_scene_decoder_stats_widget_callback(
+    GuiButtonType result,
+    InputType type,
+    void *context)
+{
+    ProtoPirateApp *app = context;
+    if (type == InputTypeShort)
+    {
+        if (result == GuiButtonTypeLeft)
+        {
+            view_dispatcher_send_custom_event(
+                app->view_dispatcher, ProtoPirateCustomEventDecoderStatsReset);
+        }
+        else if (result == GuiButtonTypeRight)
+        {
+            view_dispatcher_send_custom_event(
+                app->view_dispatcher, ProtoPirateCustomEventDecoderStatsSave);
+        }
+    }
+}
+
+static void protopirate_scene_decoder_stats_update(ProtoPirateApp *app)
+{
+    ProtoPirateDecoders *decoders = app->txrx->decoders;
+    FuriString *text = furi_string_alloc();
+
+    ProtoPirateDecodersLoad load;
+    protopirate_decoders_get_load(decoders, &load);
+    furi_string_printf(
+        text,
+        "\e#Worker load\n"
+        "Rate:%lu/s Overruns:%lu\n"
+        "Glitches:%lu\n"
+        "Lag:%lu Peak:%lu us\n"
+        "Fill peak:%u%% Shed:%u\n",
+        load.pulse_rate,
+        load.overruns,
+        load.glitches,
+        load.lag,
+        load.lag_high,
+        load.fill_high,
+        load.suspended);
+
+    furi_string_cat_printf(text, "Trace: %lu events\n", protopirate_trace_get_count(app->trace));
+
+    furi_string_cat_str(text, "\e#Latency us p50/p99/max\n");
+    for (uint8_t stage = 0; stage < ProtoPirateLatencyStageCount; stage++)
+    {
+        ProtoPirateLatencyHistogram histogram;
+        protopirate_latency_get_histogram(app->latency, stage, &histogram);
+        furi_string_cat_printf(
+            text,
+            "%s: %lu/%lu/%lu\n",
+            protopirate_latency_get_stage_name(stage),
+            protopirate_latency_get_percentile(&histogram, 50),
+            protopirate_latency_get_percentile(&histogram, 99),
+            histogram.max);
+    }
+
+    uint8_t count = protopirate_decoders_get_count(decoders);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        ProtoPirateDecodeStats stats;
+        const char *name = protopirate_decoders_get_stats(decoders, i, &stats);
+        furi_string_cat_printf(
+            text,
+            "\e#%s\n"
+            "Pulses:%lu Frames:%lu\n"
+            "Pre:%lu Abort:%lu\n"
+            "Chk:%lu Bits:%lu\n",
+            name,
+            stats.pulses,
+            stats.frames,
+            stats.preamble_starts,
+            stats.preamble_aborts,
+            stats.checksum_fails,
+            stats.bit_mismatches);
+    }
+    if (!count)
+    {
+        furi_string_set_str(text, "No decoders loaded,\nstart Receive first");
+    }
+
+    widget_reset(app->widget);
+    widget_add_text_scroll_element(app->widget, 0, 0, 128, 50, furi_string_get_cstr(text));
+    widget_add_button_element(
+        app->widget,
+        GuiButtonTypeLeft,
+        "Reset",
+        protopirate_scene_decoder_stats_widget_callback,
+        app);
+    widget_add_button_element(
+        app->widget,
+        GuiButtonTypeRight,
+        "Save",
+        protopirate_scene_decoder_stats_widget_callback,
+        app);
+
+    furi_string_free(text);
+}
+
+void protopirate_scene_decoder_stats_on_enter(void *context)
+{
+    furi_assert(context);
+    ProtoPirateApp *app = context;
+
+    protopirate_scene_decoder_stats_update(app);
+
+    view_dispatcher_switch_to_view(app->view_dispatcher, ProtoPirateViewWidget);
+}
+
+bool protopirate_scene_decoder_stats_on_event(void *context, SceneManagerEvent event)
+{
+    ProtoPirateApp *app = context;
+    bool consumed = false;
+
+    if (event.type == SceneManagerEventTypeCustom)
+    {
+        if (event.event == ProtoPirateCustomEventDecoderStatsSave)
+        {
+            if (protopirate_storage_init() &&
+                protopirate_decoders_save_stats(
+                    app->txrx->decoders, PROTOPIRATE_DECODER_STATS_PATH) &&
+                protopirate_latency_save(app->latency, PROTOPIRATE_LATENCY_PATH) &&
+                protopirate_trace_save(app->trace, PROTOPIRATE_TRACE_PATH))
+            {
+                notification_message(app->notifications, &sequence_success);
+            }
+            else
+            {
+                notification_message(app->notifications, &sequence_error);
+            }
+            consumed = true;
+        }
+        else if (event.event == ProtoPirateCustomEventDecoderStatsReset)
+        {
+            protopirate_decoders_reset_stats(app->txrx->decoders);
+            protopirate_latency_reset(app->latency);
+            protopirate_trace_reset(app->trace);
+            protopirate_scene_decoder_stats_update(app);
+            consumed = true;
+        }
+    }
+
+    return consumed;
+}
+
+void protopirate_scene_decoder_stats_on_exit(void *context)
+{
+    furi_assert(context);
+    ProtoPirateApp *app = context;
+    widget_reset(app->widget);
+}
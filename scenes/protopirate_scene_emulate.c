@@ -1,7 +1,6 @@
 // scenes/protopirate_scene_emulate.c
 #include "../protopirate_app_i.h"
 #include "../helpers/protopirate_storage.h"
-#include "../protocols/protocol_items.h"
 
 #define TAG "ProtoPirateEmulate"
 
@@ -242,16 +241,8 @@ void protopirate_scene_emulate_on_enter(void *context)
             // Set up transmitter based on protocol
             const char *proto_name = furi_string_get_cstr(emulate_context->protocol_name);
 
-            // Find the protocol in the registry
-            const SubGhzProtocol *protocol = NULL;
-            for (size_t i = 0; i < protopirate_protocol_registry.size; i++)
-            {
-                if (strcmp(protopirate_protocol_registry.items[i]->name, proto_name) == 0)
-                {
-                    protocol = protopirate_protocol_registry.items[i];
-                    break;
-                }
-            }
+            // Make sure the protocol is loaded, the receiver may have left it out
+            const SubGhzProtocol *protocol = protopirate_protocols_require(app, proto_name);
 
             if (protocol && protocol->encoder && protocol->encoder->alloc)
             {
@@ -8,30 +8,87 @@
 // Forward declaration
 void protopirate_scene_receiver_view_callback(ProtoPirateCustomEvent event, void* context);
 
+// Runs on every tick while hopping, the view redraws only if the text changed
 static void protopirate_scene_receiver_update_statusbar(void* context) {
     ProtoPirateApp* app = context;
-    FuriString* frequency_str = furi_string_alloc();
-    FuriString* modulation_str = furi_string_alloc();
-    FuriString* history_stat_str = furi_string_alloc();
+    char frequency_str[10];
+    char modulation_str[4];
+    char history_stat_str[10];
 
-    protopirate_get_frequency_modulation(app, frequency_str, modulation_str);
+    protopirate_get_frequency_modulation(
+        app, frequency_str, sizeof(frequency_str), modulation_str, sizeof(modulation_str));
 
-    furi_string_printf(
+    snprintf(
         history_stat_str,
+        sizeof(history_stat_str),
         "%u/%u",
         protopirate_history_get_item(app->txrx->history),
         KIA_DISPLAY_HISTORY_MAX);
 
     protopirate_view_receiver_add_data_statusbar(
-        app->protopirate_receiver,
-        furi_string_get_cstr(frequency_str),
-        furi_string_get_cstr(modulation_str),
-        furi_string_get_cstr(history_stat_str),
-        false);
-
-    furi_string_free(frequency_str);
-    furi_string_free(modulation_str);
-    furi_string_free(history_stat_str);
+        app->protopirate_receiver, frequency_str, modulation_str, history_stat_str, false);
+}
+
+// Caller holds the hopper mutex
+static void protopirate_scene_receiver_label_waterfall(ProtoPirateApp* app) {
+    uint8_t row_count = protopirate_waterfall_get_row_count(app->txrx->waterfall);
+    const char* preset_name = furi_string_get_cstr(app->txrx->preset->name);
+
+    if(app->txrx->hopper_state == ProtoPirateHopperStateOFF ||
+       row_count != app->txrx->scan_plan.step_count) {
+        protopirate_view_waterfall_set_row(
+            app->protopirate_waterfall, 0, app->txrx->preset->frequency, preset_name);
+        return;
+    }
+
+    for(uint8_t i = 0; i < row_count; i++) {
+        const ProtoPirateScanStep* step = protopirate_scan_plan_get_step(&app->txrx->scan_plan, i);
+        protopirate_view_waterfall_set_row(
+            app->protopirate_waterfall,
+            i,
+            step->frequency,
+            step->preset_index == PROTOPIRATE_SCAN_PRESET_KEEP ?
+                preset_name :
+                subghz_setting_get_preset_name(app->setting, step->preset_index));
+    }
+}
+
+// Hand the columns the hopper committed since the last tick to the view
+static void protopirate_scene_receiver_update_waterfall(ProtoPirateApp* app) {
+    ProtoPirateWaterfall* waterfall = app->txrx->waterfall;
+
+    furi_check(furi_mutex_acquire(app->txrx->hopper_mutex, FuriWaitForever) == FuriStatusOk);
+    uint8_t row_count = protopirate_waterfall_get_row_count(waterfall);
+    uint8_t epoch = protopirate_waterfall_get_epoch(waterfall);
+    if(epoch != app->waterfall_epoch) {
+        app->waterfall_epoch = epoch;
+        app->waterfall_sequence = 0;
+        protopirate_view_waterfall_reset(app->protopirate_waterfall, row_count);
+        protopirate_scene_receiver_label_waterfall(app);
+    }
+
+    uint32_t sequence = protopirate_waterfall_get_sequence(waterfall);
+    if(sequence - app->waterfall_sequence > PROTOPIRATE_WATERFALL_COLUMNS) {
+        app->waterfall_sequence = sequence - PROTOPIRATE_WATERFALL_COLUMNS;
+    }
+    for(; app->waterfall_sequence < sequence; app->waterfall_sequence++) {
+        const int8_t* column = protopirate_waterfall_get_column(waterfall, app->waterfall_sequence);
+        if(column) {
+            protopirate_view_waterfall_add_column(app->protopirate_waterfall, column, row_count);
+        }
+    }
+    furi_mutex_release(app->txrx->hopper_mutex);
+}
+
+// Write the pulses around a trigger to the SD, UI thread
+static void protopirate_scene_receiver_dump_flight(ProtoPirateApp* app) {
+    FuriString* path = furi_string_alloc();
+    if(protopirate_flight_recorder_dump(app->txrx->flight_recorder, app->txrx->preset, path)) {
+        notification_message(app->notifications, &sequence_success);
+    } else {
+        notification_message(app->notifications, &sequence_error);
+    }
+    furi_string_free(path);
 }
 
 static void protopirate_scene_receiver_callback(
@@ -41,21 +98,24 @@ static void protopirate_scene_receiver_callback(
     UNUSED(receiver);
     furi_assert(context);
     ProtoPirateApp* app = context;
-
-    FURI_LOG_I(TAG, "=== SIGNAL DECODED ===");
-
-    FuriString* str_buff = furi_string_alloc();
-    subghz_protocol_decoder_base_get_string(decoder_base, str_buff);
-    FURI_LOG_I(TAG, "%s", furi_string_get_cstr(str_buff));
+    protopirate_latency_begin(
+        app->latency, protopirate_decoders_get_fed_time(app->txrx->decoders));
 
     // Add to history
-    if(protopirate_history_add_to_history(app->txrx->history, decoder_base, app->txrx->preset)) {
-        notification_message(app->notifications, &sequence_semi_success);
+    bool added =
+        protopirate_history_add_to_history(app->txrx->history, decoder_base, app->txrx->preset);
+    uint32_t stored = protopirate_latency_now();
+    PROTOPIRATE_TRACE(
+        RECEIVER,
+        protopirate_trace_get_ring(app->trace),
+        ProtoPirateTraceEventReceiverFrame,
+        subghz_protocol_decoder_base_get_hash_data(decoder_base),
+        added,
+        protopirate_history_get_item(app->txrx->history),
+        0);
 
-        FURI_LOG_I(
-            TAG,
-            "Added to history, total items: %u",
-            protopirate_history_get_item(app->txrx->history));
+    if(added) {
+        notification_message(app->notifications, &sequence_semi_success);
 
         FuriString* item_name = furi_string_alloc();
         protopirate_history_get_text_item_menu(
@@ -63,22 +123,19 @@ static void protopirate_scene_receiver_callback(
 
         protopirate_view_receiver_add_item_to_menu(
             app->protopirate_receiver, furi_string_get_cstr(item_name), 0);
+        // Only now, a redraw before the item was in the menu wouldn't show it
+        protopirate_latency_stored(app->latency, stored);
 
         furi_string_free(item_name);
 
         view_dispatcher_send_custom_event(
             app->view_dispatcher, ProtoPirateCustomEventSceneReceiverUpdate);
-    } else {
-        FURI_LOG_W(TAG, "Failed to add to history (duplicate or full)");
     }
 
-    furi_string_free(str_buff);
-
-    // Pause hopper when we receive something
-    if(app->txrx->hopper_state == ProtoPirateHopperStateRunning) {
-        app->txrx->hopper_state = ProtoPirateHopperStatePause;
-        app->txrx->hopper_timeout = 10;
-    }
+    // Let the hopper credit the channel and hold on it
+    app->txrx->hopper_decode_hit = true;
+    protopirate_flight_recorder_trigger(
+        app->txrx->flight_recorder, ProtoPirateFlightTriggerDecode);
 }
 
 void protopirate_scene_receiver_on_enter(void* context) {
@@ -88,21 +145,28 @@ void protopirate_scene_receiver_on_enter(void* context) {
     FURI_LOG_I(TAG, "Frequency: %lu Hz", app->txrx->preset->frequency);
     FURI_LOG_I(TAG, "Modulation: %s", furi_string_get_cstr(app->txrx->preset->name));
 
-    // Set up the receiver callback
-    subghz_receiver_set_rx_callback(app->txrx->receiver, protopirate_scene_receiver_callback, app);
-
     // Set up view callback
     protopirate_view_receiver_set_callback(
         app->protopirate_receiver, protopirate_scene_receiver_view_callback, app);
+    protopirate_view_waterfall_set_callback(
+        app->protopirate_waterfall, protopirate_scene_receiver_view_callback, app);
 
     // Update status bar
     protopirate_scene_receiver_update_statusbar(app);
 
-    // Start hopper if enabled
+    // Start hopper if enabled, the first plan step picks frequency and preset
     if(app->txrx->hopper_state != ProtoPirateHopperStateOFF) {
         app->txrx->hopper_state = ProtoPirateHopperStateRunning;
+        protopirate_hopper_prepare(app);
     }
 
+    // Load the decoders for what the plan covers, this may rebuild the receiver
+    protopirate_protocols_load_for_rx(app);
+    app->flight_fails = protopirate_decoders_get_fail_count(app->txrx->decoders);
+
+    // Set up the receiver callback
+    subghz_receiver_set_rx_callback(app->txrx->receiver, protopirate_scene_receiver_callback, app);
+
     // Get preset data
     const char* preset_name = furi_string_get_cstr(app->txrx->preset->name);
     uint8_t* preset_data = subghz_setting_get_preset_data_by_name(app->setting, preset_name);
@@ -116,15 +180,13 @@ void protopirate_scene_receiver_on_enter(void* context) {
     protopirate_begin(app, preset_data);
 
     uint32_t frequency = app->txrx->preset->frequency;
-    if(app->txrx->hopper_state == ProtoPirateHopperStateRunning) {
-        frequency = subghz_setting_get_hopper_frequency(app->setting, 0);
-        app->txrx->hopper_idx_frequency = 0;
-    }
-
     FURI_LOG_I(TAG, "Starting RX on %lu Hz", frequency);
     protopirate_rx(app, frequency);
     FURI_LOG_I(TAG, "RX started, state: %d", app->txrx->txrx_state);
 
+    // Hopping and RSSI sampling run on their own thread from here on
+    protopirate_hopper_start(app);
+
     // Switch to receiver view
     view_dispatcher_switch_to_view(app->view_dispatcher, ProtoPirateViewReceiver);
 }
@@ -157,6 +219,7 @@ bool protopirate_scene_receiver_on_event(void* context, SceneManagerEvent event)
             break;
 
         case ProtoPirateCustomEventViewReceiverBack:
+            protopirate_hopper_stop(app);
             if(app->txrx->txrx_state == ProtoPirateTxRxStateRx) {
                 protopirate_rx_end(app);
             }
@@ -170,18 +233,51 @@ bool protopirate_scene_receiver_on_event(void* context, SceneManagerEvent event)
         case ProtoPirateCustomEventViewReceiverUnlock:
             consumed = true;
             break;
+
+        case ProtoPirateCustomEventViewReceiverRecord:
+            protopirate_flight_recorder_trigger(
+                app->txrx->flight_recorder, ProtoPirateFlightTriggerManual);
+            protopirate_scene_receiver_dump_flight(app);
+            consumed = true;
+            break;
+
+        case ProtoPirateCustomEventViewReceiverWaterfall:
+            // Same scene, so the radio and hopper keep running behind the map
+            furi_check(
+                furi_mutex_acquire(app->txrx->hopper_mutex, FuriWaitForever) == FuriStatusOk);
+            protopirate_scene_receiver_label_waterfall(app);
+            furi_mutex_release(app->txrx->hopper_mutex);
+            view_dispatcher_switch_to_view(app->view_dispatcher, ProtoPirateViewWaterfall);
+            consumed = true;
+            break;
+
+        case ProtoPirateCustomEventViewWaterfallBack:
+            view_dispatcher_switch_to_view(app->view_dispatcher, ProtoPirateViewReceiver);
+            consumed = true;
+            break;
         }
     } else if(event.type == SceneManagerEventTypeTick) {
-        // Update hopper
+        // Hopper thread may have moved the frequency
         if(app->txrx->hopper_state != ProtoPirateHopperStateOFF) {
-            protopirate_hopper_update(app);
             protopirate_scene_receiver_update_statusbar(app);
         }
 
-        // Update RSSI
-        if(app->txrx->txrx_state == ProtoPirateTxRxStateRx) {
-            float rssi = subghz_devices_get_rssi(app->txrx->radio_device);
-            protopirate_view_receiver_set_rssi(app->protopirate_receiver, rssi);
+        // Latest RSSI sample from the hopper thread
+        protopirate_view_receiver_set_rssi(
+            app->protopirate_receiver, protopirate_hopper_get_rssi(app));
+
+        protopirate_scene_receiver_update_waterfall(app);
+
+        // Fail counters only move on the worker thread, poll them here
+        uint32_t fails = protopirate_decoders_get_fail_count(app->txrx->decoders);
+        if(fails > app->flight_fails) {
+            protopirate_flight_recorder_trigger(
+                app->txrx->flight_recorder, ProtoPirateFlightTriggerFail);
+        }
+        app->flight_fails = fails;
+        if(protopirate_flight_recorder_get_pending(app->txrx->flight_recorder) !=
+           ProtoPirateFlightTriggerNone) {
+            protopirate_scene_receiver_dump_flight(app);
         }
 
         consumed = true;
@@ -195,9 +291,13 @@ void protopirate_scene_receiver_on_exit(void* context) {
 
     FURI_LOG_I(TAG, "=== EXITING RECEIVER SCENE ===");
 
+    protopirate_hopper_stop(app);
+
     if(app->txrx->txrx_state == ProtoPirateTxRxStateRx) {
         protopirate_rx_end(app);
     }
+    // The next receiver draw is seconds away, it would skew the display stage
+    protopirate_latency_cancel(app->latency);
 }
 
 void protopirate_scene_receiver_view_callback(ProtoPirateCustomEvent event, void* context) {
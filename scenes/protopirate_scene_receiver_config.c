@@ -1,21 +1,71 @@
 // scenes/protopirate_scene_receiver_config.c
 #include "../protopirate_app_i.h"
+#include <lib/toolbox/value_index.h>
 
 enum ProtoPirateSettingIndex {
     ProtoPirateSettingIndexFrequency,
     ProtoPirateSettingIndexHopping,
+    ProtoPirateSettingIndexDwell,
     ProtoPirateSettingIndexModulation,
+    ProtoPirateSettingIndexGlitchFilter,
+    ProtoPirateSettingIndexFlightRecorder,
     ProtoPirateSettingIndexLock,
 };
 
-#define HOPPING_COUNT 2
+#define HOPPING_COUNT 3
 const char* const hopping_text[HOPPING_COUNT] = {
     "OFF",
     "ON",
+    "Freq+Mod",
 };
 const uint32_t hopping_value[HOPPING_COUNT] = {
     ProtoPirateHopperStateOFF,
     ProtoPirateHopperStateRunning,
+    ProtoPirateHopperStateRunning,
+};
+// "Freq+Mod" also cycles the scan presets on every frequency
+#define HOPPING_INDEX_SCAN_MODULATION 2
+
+#define DWELL_COUNT 6
+const char* const dwell_text[DWELL_COUNT] = {
+    "10ms",
+    "20ms",
+    "50ms",
+    "100ms",
+    "200ms",
+    "500ms",
+};
+const uint32_t dwell_value[DWELL_COUNT] = {
+    10,
+    20,
+    50,
+    100,
+    200,
+    500,
+};
+
+#define GLITCH_FILTER_COUNT 6
+const char* const glitch_filter_text[GLITCH_FILTER_COUNT] = {
+    "OFF",
+    "30us",
+    "60us",
+    "100us",
+    "150us",
+    "250us",
+};
+const uint32_t glitch_filter_value[GLITCH_FILTER_COUNT] = {
+    0,
+    30,
+    60,
+    100,
+    150,
+    250,
+};
+
+const char* const flight_recorder_text[ProtoPirateFlightRecorderModeCount] = {
+    [ProtoPirateFlightRecorderModeManual] = "Manual",
+    [ProtoPirateFlightRecorderModeFails] = "Fails",
+    [ProtoPirateFlightRecorderModeAll] = "All",
 };
 
 uint8_t protopirate_scene_receiver_config_next_frequency(const uint32_t value, void* context) {
@@ -62,7 +112,7 @@ uint8_t protopirate_scene_receiver_config_hopper_value_index(
             (VariableItem*)scene_manager_get_scene_state(
                 app->scene_manager, ProtoPirateSceneReceiverConfig),
             " -----");
-        return 1;
+        return app->txrx->hopper_scan_modulation ? HOPPING_INDEX_SCAN_MODULATION : 1;
     }
 }
 
@@ -86,6 +136,14 @@ static void protopirate_scene_receiver_config_set_frequency(VariableItem* item)
     }
 }
 
+static void protopirate_scene_receiver_config_set_dwell(VariableItem* item) {
+    ProtoPirateApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+
+    variable_item_set_current_value_text(item, dwell_text[index]);
+    app->txrx->hopper_dwell_ms = MAX(dwell_value[index], PROTOPIRATE_HOPPER_DWELL_MS_MIN);
+}
+
 static void protopirate_scene_receiver_config_set_preset(VariableItem* item) {
     ProtoPirateApp* app = variable_item_get_context(item);
     uint8_t index = variable_item_get_current_value_index(item);
@@ -99,6 +157,22 @@ static void protopirate_scene_receiver_config_set_preset(VariableItem* item) {
         subghz_setting_get_preset_data_size(app->setting, index));
 }
 
+static void protopirate_scene_receiver_config_set_glitch_filter(VariableItem* item) {
+    ProtoPirateApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+
+    variable_item_set_current_value_text(item, glitch_filter_text[index]);
+    protopirate_set_glitch_filter(app, glitch_filter_value[index]);
+}
+
+static void protopirate_scene_receiver_config_set_flight_recorder(VariableItem* item) {
+    ProtoPirateApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+
+    variable_item_set_current_value_text(item, flight_recorder_text[index]);
+    protopirate_flight_recorder_set_mode(app->txrx->flight_recorder, index);
+}
+
 static void protopirate_scene_receiver_config_set_hopping_running(VariableItem* item) {
     ProtoPirateApp* app = variable_item_get_context(item);
     uint8_t index = variable_item_get_current_value_index(item);
@@ -133,6 +207,7 @@ static void protopirate_scene_receiver_config_set_hopping_running(VariableItem*
     }
 
     app->txrx->hopper_state = hopping_value[index];
+    app->txrx->hopper_scan_modulation = (index == HOPPING_INDEX_SCAN_MODULATION);
 }
 
 static void
@@ -181,6 +256,16 @@ void protopirate_scene_receiver_config_on_enter(void* context) {
     variable_item_set_current_value_index(item, value_index);
     variable_item_set_current_value_text(item, hopping_text[value_index]);
 
+    item = variable_item_list_add(
+        app->variable_item_list,
+        "Dwell:",
+        DWELL_COUNT,
+        protopirate_scene_receiver_config_set_dwell,
+        app);
+    value_index = value_index_uint32(app->txrx->hopper_dwell_ms, dwell_value, DWELL_COUNT);
+    variable_item_set_current_value_index(item, value_index);
+    variable_item_set_current_value_text(item, dwell_text[value_index]);
+
     item = variable_item_list_add(
         app->variable_item_list,
         "Modulation:",
@@ -193,6 +278,27 @@ void protopirate_scene_receiver_config_on_enter(void* context) {
     variable_item_set_current_value_text(
         item, subghz_setting_get_preset_name(app->setting, value_index));
 
+    item = variable_item_list_add(
+        app->variable_item_list,
+        "Glitch Flt:",
+        GLITCH_FILTER_COUNT,
+        protopirate_scene_receiver_config_set_glitch_filter,
+        app);
+    value_index = value_index_uint32(
+        app->txrx->glitch_filter_us, glitch_filter_value, GLITCH_FILTER_COUNT);
+    variable_item_set_current_value_index(item, value_index);
+    variable_item_set_current_value_text(item, glitch_filter_text[value_index]);
+
+    item = variable_item_list_add(
+        app->variable_item_list,
+        "Flight Rec:",
+        ProtoPirateFlightRecorderModeCount,
+        protopirate_scene_receiver_config_set_flight_recorder,
+        app);
+    value_index = protopirate_flight_recorder_get_mode(app->txrx->flight_recorder);
+    variable_item_set_current_value_index(item, value_index);
+    variable_item_set_current_value_text(item, flight_recorder_text[value_index]);
+
     variable_item_list_add(app->variable_item_list, "Lock Keyboard", 1, NULL, NULL);
     variable_item_list_set_enter_callback(
         app->variable_item_list, protopirate_scene_receiver_config_var_list_enter_callback, app);
@@ -37,6 +37,17 @@ void protopirate_scene_receiver_info_on_enter(void *context)
     widget_add_string_multiline_element(
         app->widget, 0, 14, AlignLeft, AlignTop, FontSecondary, furi_string_get_cstr(text));
 
+    // Timing margins of the capture, left of the Save button
+    ProtoPirateFrameQuality quality;
+    protopirate_history_get_quality(app->txrx->history, app->txrx->idx_menu_chosen, &quality);
+    if (quality.score)
+    {
+        furi_string_printf(
+            text, "Q:%u%% min %u%% b%u", quality.score, quality.weakest, quality.weakest_bit);
+        widget_add_string_element(
+            app->widget, 0, 64, AlignLeft, AlignBottom, FontSecondary, furi_string_get_cstr(text));
+    }
+
     // Add save button
     widget_add_button_element(
         app->widget,
@@ -6,6 +6,7 @@ typedef enum
     SubmenuIndexProtoPirateReceiver,
     SubmenuIndexProtoPirateSaved,
     SubmenuIndexProtoPirateReceiverConfig,
+    SubmenuIndexProtoPirateDecoderStats,
     SubmenuIndexProtoPirateAbout,
 } SubmenuIndex;
 
@@ -42,6 +43,13 @@ void protopirate_scene_start_on_enter(void *context)
         protopirate_scene_start_submenu_callback,
         app);
 
+    submenu_add_item(
+        app->submenu,
+        "Decoder Stats",
+        SubmenuIndexProtoPirateDecoderStats,
+        protopirate_scene_start_submenu_callback,
+        app);
+
     submenu_add_item(
         app->submenu,
         "About",
@@ -83,6 +91,11 @@ bool protopirate_scene_start_on_event(void *context, SceneManagerEvent event)
             scene_manager_next_scene(app->scene_manager, ProtoPirateSceneReceiverConfig);
             consumed = true;
         }
+        else if (event.event == SubmenuIndexProtoPirateDecoderStats)
+        {
+            scene_manager_next_scene(app->scene_manager, ProtoPirateSceneDecoderStats);
+            consumed = true;
+        }
         scene_manager_set_scene_state(app->scene_manager, ProtoPirateSceneStart, event.event);
     }
 
@@ -0,0 +1,342 @@
+// tools/host/bench.c
+#include "host_decoders.h"
+#include "host_cost.h"
+#include "host_corpus.h"
+#include "host_pulsegen.h"
+
+#include <unistd.h>
+
+// Decoder stress benchmark. Mixes the corpus captures into a generated pulse
+// stream (see host_pulsegen.h) under the RF conditions of a profile, feeds
+// it to every decoder of the registry pulse by pulse like the worker does
+// and reports per decoder:
+//
+//   ns      mean CPU time of a feed, fastest of BENCH_RUNS untimed replays
+//   max     costliest single feed, in host_cost_unit()
+//   yield   bursts of its captures it decoded at least one frame from
+//   ghost   frames it decoded anywhere but in its own captures
+//
+// plus what a radio pulse costs the whole registry. Same seed, same stream.
+//
+//   ./build/bench [-p profile] [-s seed] [-n bursts per capture] [-o stream.sub] [corpus...]
+//
+// -o writes the stream of one profile as RAW .sub, replay it with a sim
+// script or the Sub-GHz app.
+
+#define BENCH_FREQUENCY 433920000
+#define BENCH_PRESET    "FuriHalSubGhzPresetOok650Async"
+// A frame completes on the gap after its burst at the latest
+#define BENCH_SLACK 2
+#define BENCH_RUNS  5
+
+typedef struct {
+    const char* name;
+    HostPulseGenConfig config;
+} BenchProfile;
+
+static const BenchProfile bench_profiles[] = {
+    {"clean", {.idle_min = 20000, .idle_max = 50000}},
+    {"timing",
+     {.idle_min = 20000, .idle_max = 50000, .jitter = 60, .drift_permille = 30}},
+    {"noise",
+     {.idle_min = 20000,
+      .idle_max = 50000,
+      .noise_rate = 2000,
+      .noise_max = 150,
+      .glitch_permille = 3}},
+    {"traffic",
+     {.idle_min = 20000,
+      .idle_max = 50000,
+      .long_idle_percent = 10,
+      .long_idle = 2000000,
+      .traffic_percent = 50}},
+    {"worst",
+     {.idle_min = 5000,
+      .idle_max = 50000,
+      .long_idle_percent = 10,
+      .long_idle = 2000000,
+      .noise_rate = 4000,
+      .noise_max = 200,
+      .glitch_permille = 5,
+      .jitter = 80,
+      .drift_permille = 40,
+      .dropout_percent = 20,
+      .traffic_percent = 50}},
+};
+
+typedef struct {
+    const SubGhzProtocol* protocol;
+    HostRaw* raw;
+} BenchSource;
+
+typedef struct BenchRun BenchRun;
+
+typedef struct {
+    BenchRun* run;
+    HostDecoder* decoder;
+    uint32_t ghosts;
+} BenchDecoder;
+
+struct BenchRun {
+    const BenchSource* source;
+    const HostPulseGenMark* mark;
+    size_t mark_count;
+    // Bursts a frame of their own protocol came from
+    bool* hit;
+    size_t pulse;
+    // Last mark starting at or before pulse
+    size_t cursor;
+};
+
+static void bench_frame_callback(HostDecoder* decoder, void* context) {
+    BenchDecoder* bench = context;
+    BenchRun* run = bench->run;
+
+    while(run->cursor + 1 < run->mark_count && run->mark[run->cursor + 1].start <= run->pulse) {
+        run->cursor++;
+    }
+    const HostPulseGenMark* mark = &run->mark[run->cursor];
+    if(mark->start <= run->pulse && run->pulse < mark->end + BENCH_SLACK &&
+       run->source[mark->source].protocol == decoder->protocol) {
+        run->hit[run->cursor] = true;
+    } else {
+        bench->ghosts++;
+    }
+}
+
+// Fastest of BENCH_RUNS replays through one decoder, timing every feed would
+// mostly time the clock
+static uint64_t bench_time(const SubGhzProtocol* protocol, const HostRaw* stream) {
+    uint64_t best = UINT64_MAX;
+    for(uint32_t run = 0; run < BENCH_RUNS; run++) {
+        HostDecoder* decoder = host_decoder_alloc(protocol, NULL, NULL);
+        host_decoder_reset(decoder);
+        uint64_t start = host_cost_ns();
+        host_decoder_feed_raw(decoder, stream->value, stream->count);
+        best = MIN(best, host_cost_ns() - start);
+        host_decoder_free(decoder);
+    }
+    return best;
+}
+
+static void bench_run(
+    const BenchProfile* profile,
+    const BenchSource* source,
+    size_t source_count,
+    uint32_t seed,
+    uint32_t bursts,
+    const char* out_path) {
+    HostPulseGenConfig config = profile->config;
+    config.seed = seed;
+    HostPulseGen* gen = host_pulsegen_alloc(&config);
+
+    // Every capture the same number of times, in turn
+    size_t mark_count = source_count * bursts;
+    HostPulseGenMark* mark = malloc(mark_count * sizeof(HostPulseGenMark));
+    for(size_t i = 0; i < mark_count; i++) {
+        mark[i] = host_pulsegen_add_burst(gen, source[i % source_count].raw, i % source_count);
+    }
+    host_pulsegen_add_idle(gen);
+    const HostRaw* stream = host_pulsegen_get_stream(gen);
+
+    if(out_path && !host_raw_save(stream, out_path, BENCH_FREQUENCY, BENCH_PRESET)) {
+        fprintf(stderr, "%s: can't write\n", out_path);
+    }
+
+    BenchRun run = {
+        .source = source,
+        .mark = mark,
+        .mark_count = mark_count,
+        .hit = calloc(mark_count, sizeof(bool)),
+    };
+    size_t count = host_decoders_get_count();
+    BenchDecoder* bench = calloc(count, sizeof(BenchDecoder));
+    for(size_t i = 0; i < count; i++) {
+        bench[i].run = &run;
+        bench[i].decoder =
+            host_decoder_alloc(host_decoders_get(i), bench_frame_callback, &bench[i]);
+        host_decoder_reset(bench[i].decoder);
+    }
+
+    // What one radio pulse costs the worker at most, all decoders together
+    uint64_t pulse_max = 0;
+    for(run.pulse = 0; run.pulse < stream->count; run.pulse++) {
+        int32_t value = stream->value[run.pulse];
+        uint64_t cost = 0;
+        for(size_t i = 0; i < count; i++) {
+            cost += host_decoder_feed(bench[i].decoder, value > 0, value > 0 ? value : -value);
+        }
+        pulse_max = MAX(pulse_max, cost);
+    }
+
+    printf(
+        "%s: %zu bursts, %zu pulses, %.1f s on air, seed %lu\n",
+        profile->name,
+        mark_count,
+        stream->count,
+        host_pulsegen_get_time(gen) / 1e6,
+        (unsigned long)seed);
+    printf(
+        "  %-12s %8s %10s %7s %8s %6s\n",
+        "decoder",
+        "ns",
+        "max",
+        "frames",
+        "yield",
+        "ghost");
+
+    uint32_t yield_sum = 0;
+    uint32_t yield_bursts = 0;
+    uint32_t ghost_sum = 0;
+    uint64_t time_sum = 0;
+    for(size_t i = 0; i < count; i++) {
+        HostDecoder* decoder = bench[i].decoder;
+        uint64_t time = bench_time(decoder->protocol, stream);
+        time_sum += time;
+        uint32_t yield = 0;
+        uint32_t own = 0;
+        for(size_t m = 0; m < mark_count; m++) {
+            if(source[mark[m].source].protocol != decoder->protocol) continue;
+            own++;
+            if(run.hit[m]) yield++;
+        }
+        yield_sum += yield;
+        yield_bursts += own;
+        ghost_sum += bench[i].ghosts;
+
+        char yield_text[24];
+        snprintf(
+            yield_text, sizeof(yield_text), "%lu/%lu", (unsigned long)yield, (unsigned long)own);
+        printf(
+            "  %-12s %8.1f %10llu %7lu %8s %6lu\n",
+            decoder->protocol->name,
+            (double)time / stream->count,
+            (unsigned long long)decoder->cost_max,
+            (unsigned long)decoder->frames,
+            yield_text,
+            (unsigned long)bench[i].ghosts);
+    }
+    printf(
+        "  all: %.1f ns, max %llu %s per pulse, yield %lu/%lu, %lu ghosts\n\n",
+        (double)time_sum / stream->count,
+        (unsigned long long)pulse_max,
+        host_cost_unit(),
+        (unsigned long)yield_sum,
+        (unsigned long)yield_bursts,
+        (unsigned long)ghost_sum);
+
+    for(size_t i = 0; i < count; i++) {
+        host_decoder_free(bench[i].decoder);
+    }
+    free(bench);
+    free(run.hit);
+    free(mark);
+    host_pulsegen_free(gen);
+}
+
+// Adds every capture of folder this build has a decoder for
+static bool bench_load_sources(const char* folder, BenchSource** source, size_t* count) {
+    size_t name_count;
+    char** name = host_corpus_list(folder, &name_count);
+    if(!name) {
+        fprintf(stderr, "%s: can't open\n", folder);
+        return false;
+    }
+
+    *source = realloc(*source, (*count + name_count + 1) * sizeof(BenchSource));
+    for(size_t i = 0; i < name_count; i++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", folder, name[i]);
+        HostCorpusEntry entry = {0};
+        if(host_corpus_load(&entry, path)) {
+            const SubGhzProtocol* protocol = host_decoders_find(entry.decoder);
+            snprintf(path, sizeof(path), "%s/%s", folder, entry.capture);
+            HostRaw* raw = protocol ? host_raw_load(path) : NULL;
+            if(raw) {
+                (*source)[*count].protocol = protocol;
+                (*source)[(*count)++].raw = raw;
+            }
+        }
+        host_corpus_free(&entry);
+    }
+    host_corpus_list_free(name, name_count);
+    return true;
+}
+
+static void bench_usage(void) {
+    fprintf(
+        stderr,
+        "usage: bench [-p profile] [-s seed] [-n bursts per capture] [-o stream.sub] [corpus...]\n"
+        "profiles:");
+    for(size_t i = 0; i < COUNT_OF(bench_profiles); i++) {
+        fprintf(stderr, " %s", bench_profiles[i].name);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char** argv) {
+    const char* profile_name = NULL;
+    const char* out_path = NULL;
+    uint32_t seed = 1;
+    uint32_t bursts = 4;
+
+    int option;
+    while((option = getopt(argc, argv, "p:s:n:o:")) != -1) {
+        switch(option) {
+        case 'p':
+            profile_name = optarg;
+            break;
+        case 's':
+            seed = strtoul(optarg, NULL, 0);
+            break;
+        case 'n':
+            bursts = strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            out_path = optarg;
+            break;
+        default:
+            bench_usage();
+            return 1;
+        }
+    }
+    const BenchProfile* profile = NULL;
+    for(size_t i = 0; profile_name && i < COUNT_OF(bench_profiles); i++) {
+        if(!strcmp(bench_profiles[i].name, profile_name)) profile = &bench_profiles[i];
+    }
+    if((profile_name && !profile) || (out_path && !profile) || !bursts) {
+        // One stream per file, -o needs the profile
+        bench_usage();
+        return 1;
+    }
+
+    BenchSource* source = NULL;
+    size_t source_count = 0;
+    bool loaded = true;
+    if(optind < argc) {
+        for(int i = optind; i < argc; i++) {
+            loaded &= bench_load_sources(argv[i], &source, &source_count);
+        }
+    } else {
+        for(size_t i = 0; i < host_corpus_default_count; i++) {
+            loaded &= bench_load_sources(host_corpus_default[i], &source, &source_count);
+        }
+    }
+    if(!loaded || !source_count) {
+        if(loaded) fprintf(stderr, "no captures\n");
+        free(source);
+        return 1;
+    }
+
+    host_cost_init();
+    for(size_t i = 0; i < COUNT_OF(bench_profiles); i++) {
+        if(profile && profile != &bench_profiles[i]) continue;
+        bench_run(&bench_profiles[i], source, source_count, seed, bursts, out_path);
+    }
+
+    for(size_t i = 0; i < source_count; i++) {
+        host_raw_free(source[i].raw);
+    }
+    free(source);
+    return 0;
+}
@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""Write the golden capture corpus, one RAW .sub per protocol.
+
+Nobody here owns every fob, so the captures are synthesized from the frame
+layouts the decoders in protocols/ implement: preamble, sync and the data
+coding of each, a few microseconds of seeded jitter on every pulse, three
+repeats of the frame with gaps in between. The output is deterministic,
+rerun it only when a layout below changes and review the diff of the
+.golden files the runner then reports.
+
+Real captures go next to these the same way: a flight recorder dump or a
+Sub-GHz app RAW recording plus a .golden file, see tools/host/golden.c.
+
+    python3 tools/host/corpus/synthesize.py [output dir]
+"""
+
+import os
+import random
+import sys
+
+FREQUENCY = 433920000
+PRESET_AM = "FuriHalSubGhzPresetOok650Async"
+PRESET_FM = "FuriHalSubGhzPreset2FSKDev476Async"
+# Values per RAW_Data line, same as the Sub-GHz app
+RAW_LINE = 512
+REPEATS = 3
+GAP_US = 15000
+
+KIA_MF_KEY = 0xA8F5DFFC8DAA5CDB
+KEELOQ_NLF = 0x3A5C742E
+
+
+def bits_of(value, count):
+    """MSB first"""
+    return [(value >> (count - 1 - i)) & 1 for i in range(count)]
+
+
+def reverse8(byte):
+    return int("{:08b}".format(byte)[::-1], 2)
+
+
+def runs(levels, te):
+    """Half-bit or raw bit levels to (level, duration), equal neighbours merge"""
+    pulses = []
+    for level in levels:
+        if pulses and pulses[-1][0] == level:
+            pulses[-1] = (level, pulses[-1][1] + te)
+        else:
+            pulses.append((level, te))
+    return pulses
+
+
+def manchester(bits, one, zero):
+    levels = []
+    for bit in bits:
+        levels += one if bit else zero
+    return levels
+
+
+def raw_tail(levels):
+    """The last raw bit of a run merges into the gap, end on one more edge"""
+    return levels + ([1] if levels[-1] == 0 else [0, 1])
+
+
+def keeloq_encrypt(data, key):
+    block = data
+    for i in range(528):
+        lutkey = (
+            ((block >> 1) & 1)
+            | ((block >> 8) & 2)
+            | ((block >> 18) & 4)
+            | ((block >> 23) & 8)
+            | ((block >> 27) & 16)
+        )
+        bit = (block ^ (block >> 16) ^ (KEELOQ_NLF >> lutkey) ^ (key >> (i & 63))) & 1
+        block = (block >> 1) | (bit << 31)
+    return block
+
+
+def keeloq_decrypt(data, key):
+    """Mirror of protocols/kia_v3_v4.c, checks the encryption above"""
+    block = data
+    tkey = key
+    for _ in range(528):
+        lutkey = (
+            (block & 1)
+            | ((block >> 7) & 2)
+            | ((block >> 17) & 4)
+            | ((block >> 22) & 8)
+            | ((block >> 26) & 16)
+        )
+        lsb = ((block >> 31) ^ (block >> 15) ^ (KEELOQ_NLF >> lutkey) ^ (tkey >> 15)) & 1
+        block = ((block << 1) & 0xFFFFFFFF) | lsb
+        tkey = ((tkey << 1) & 0xFFFFFFFFFFFFFFFF) | (tkey >> 63)
+    return block
+
+
+def kia_v0():
+    # 61 bits, the decoder counts the sync as the leading 1
+    serial, btn, cnt, crc = 0x5A3C7E1, 0x2, 0x1A2B, 0x5D
+    data = (1 << 59) | (cnt << 40) | (serial << 12) | (btn << 8) | crc
+    pulses = [(1, 250), (0, 250)] * 20 + [(1, 500), (0, 500)]
+    for bit in bits_of(data, 59):
+        te = 500 if bit else 250
+        pulses += [(1, te), (0, te)]
+    return pulses + [(1, 1200)], PRESET_FM
+
+
+def kia_v1():
+    # PCM at 800us, 10 is 1, the sync high is the first raw bit
+    serial, btn, cnt, crc = 0xB1C2D3E4, 0x01, 0x37, 0x9A
+    data = (serial << 24) | (btn << 16) | (cnt << 8) | crc
+    levels = manchester(bits_of(data, 56), [1, 0], [0, 1])
+    if levels[0] == 0:
+        levels = [1] + levels
+    pulses = [(1, 1600), (0, 1600)] * 7 + [(1, 1600), (0, 800)]
+    return pulses + runs(raw_tail(levels), 800), PRESET_AM
+
+
+def kia_v2():
+    # PCM at 500us, 53 bits: marker, serial, button, byte swapped counter, CRC
+    serial, btn, raw_cnt, crc = 0x4D5E6F70, 0x3, 0x2A1, 0x6
+    data = (1 << 52) | (serial << 20) | (btn << 16) | (raw_cnt << 4) | crc
+    levels = manchester(bits_of(data, 53), [1, 0], [0, 1])
+    pulses = [(1, 1000), (0, 1000)] * 8 + [(1, 500), (0, 500)]
+    return pulses + runs(raw_tail(levels), 500), PRESET_FM
+
+
+def kia_v3_v4_frame(v3):
+    # KeeLoq, hop then fixed part, each byte sent LSB first
+    serial, btn, cnt = 0x7C3A5E1, 0x1 if v3 else 0x2, 0x0150 if v3 else 0x0151
+    plain = (btn << 28) | ((serial & 0x3FF) << 16) | cnt
+    hop = keeloq_encrypt(plain, KIA_MF_KEY)
+    assert keeloq_decrypt(hop, KIA_MF_KEY) == plain
+    data = [reverse8((hop >> (8 * i)) & 0xFF) for i in range(4)]
+    data += [reverse8((serial >> (8 * i)) & 0xFF) for i in range(3)]
+    data += [reverse8((btn << 4) | ((serial >> 24) & 0xF))]
+
+    pulses = [(1, 400), (0, 400)] * 16
+    if v3:
+        # Long low sync, the data goes out inverted
+        pulses[-1] = (0, 1200)
+        data = [~b & 0xFF for b in data]
+    else:
+        pulses.append((1, 1200))
+        pulses.append((0, 400))
+    for byte in data:
+        for bit in bits_of(byte, 8):
+            pulses += [(1, 800), (0, 400)] if bit else [(1, 400), (0, 800)]
+    return pulses[:-1]
+
+
+def kia_v3():
+    return kia_v3_v4_frame(True), PRESET_AM
+
+
+def kia_v4():
+    return kia_v3_v4_frame(False), PRESET_FM
+
+
+def kia_v5():
+    # 64 bits, 01 is 1, fields in the bit reversed word
+    serial, btn, cnt = 0x2468ACE, 0x5, 0x0C0D
+    yek = (btn << 61) | ((serial << 1) << 32) | cnt
+    data = int("{:064b}".format(yek)[::-1], 2)
+    levels = [1, 0] + manchester(bits_of(data, 64), [0, 1], [1, 0])
+    pulses = [(1, 400), (0, 400)] * 45 + [(1, 400), (0, 800)]
+    return pulses + runs(raw_tail(levels), 400), PRESET_FM
+
+
+def ford_v0():
+    # Inverse of decode_ford_v0(): 64-bit key1 and 16-bit key2, both sent inverted
+    serial, btn, cnt, bs, crc = 0x1F2E3D4C, 0x4, 0x0A5A5, 0x51, 0xC3
+    buf = [0x3E, *serial.to_bytes(4, "big"), (btn << 4) | (cnt >> 16), 0, 0]
+    f6, f7 = (cnt >> 8) & 0xFF, cnt & 0xFF
+    o7 = (f7 & 0xAA) | (f6 & 0x55)
+    b6 = (f6 & 0xAA) | (f7 & 0x55)
+    if bin(bs).count("1") & 1:
+        buf[7] = o7
+        buf[6] = b6 ^ o7
+        buf[1:6] = [b ^ o7 for b in buf[1:6]]
+    else:
+        buf[6] = b6
+        buf[7] = o7 ^ b6
+        buf[1:6] = [b ^ b6 for b in buf[1:6]]
+    key1 = int.from_bytes(bytes(buf), "big")
+    key2 = (bs << 8) | crc
+    assert not key1 >> 63, "the frame starts with a 1 sent as the inverted key1 MSB"
+
+    bits = bits_of(~key1 & 0xFFFFFFFFFFFFFFFF, 64) + bits_of(~key2 & 0xFFFF, 16)
+    pulses = [(1, 250)] + [(0, 500), (1, 500)] * 6 + [(0, 500), (1, 250), (0, 3500)]
+    return pulses + runs(manchester(bits, [1, 0], [0, 1]), 250), PRESET_FM
+
+
+def subaru():
+    # Short high is 1, the counter is scrambled into bytes 4-7
+    data = [0x03, 0x6B, 0x2C, 0x19, 0x8E, 0x37, 0xA4, 0x52]
+    pulses = [(1, 1600), (0, 1600)] * 12
+    pulses[-1] = (0, 2800)
+    pulses += [(1, 2800), (0, 1600)]
+    for byte in data:
+        for bit in bits_of(byte, 8):
+            pulses += [(1, 800), (0, 1600)] if bit else [(1, 1600), (0, 800)]
+    return pulses[:-1], PRESET_AM
+
+
+def suzuki():
+    # Long high is 1, manufacturer nibble F first
+    serial, btn, cnt, crc = 0x3B7C9D1, 0x3, 0x4E21, 0xA7
+    data = (0xF << 60) | (cnt << 44) | (serial << 16) | (btn << 12) | (crc << 4)
+    pulses = [(1, 250)] + [(0, 250), (1, 250)] * 260 + [(0, 250)]
+    for bit in bits_of(data, 64):
+        pulses += [(1, 500 if bit else 250), (0, 250)]
+    # The gap must stay near 2ms, the next repeat's first high closes it
+    return pulses[:-1] + [(0, 2000), (1, 250)], PRESET_AM
+
+
+def vw():
+    # Type, 64 data bits, check byte with the button in its high nibble
+    vw_type, key, check = 0xC0, 0x3F1A5E7B9C2D4086, 0x2B
+    bits = bits_of(vw_type, 8) + bits_of(key, 64) + bits_of(check, 8)
+    pulses = [(1, 500), (0, 500)] * 20 + [(1, 1000), (0, 500), (1, 750), (0, 750)]
+    return pulses + runs(manchester(bits, [1, 0], [0, 1]), 500), PRESET_AM
+
+
+def fiat_v0():
+    # Hop, fixed part and a 7-bit end field, a lead 1 syncs the Manchester state
+    hop, fix, end = 0x8D2F4A61, 0x0E1F2A3B, 0x55
+    bits = [1] + bits_of(hop, 32) + bits_of(fix, 32) + bits_of(end, 7)
+    pulses = [(1, 200)] + [(0, 200), (1, 200)] * 160 + [(0, 800)]
+    return pulses + runs(manchester(bits, [1, 0], [0, 1]), 200), PRESET_FM
+
+
+def pirateproto2_pwm():
+    # tools/host/host_pwm.c: 64 bits, PWM at 250/500us
+    data = 0x5C3A917E24B6D80F
+    pulses = [(1, 250), (0, 250)] * 10 + [(1, 500), (0, 1000)]
+    for bit in bits_of(data, 64):
+        pulses += [(1, 500), (0, 250)] if bit else [(1, 250), (0, 500)]
+    return pulses[:-1], PRESET_FM
+
+
+def pirateproto2_ppm():
+    # tools/host/host_pwm.c: 40 bits, the low carries the bit, a stop high ends it
+    serial, btn, cnt = 0xA1B2C3, 0x6, 0x2D4
+    data = (serial << 16) | (btn << 12) | cnt
+    pulses = [(1, 400), (0, 400)] * 14 + [(1, 800), (0, 2000)]
+    for bit in bits_of(data, 40):
+        pulses += [(1, 400), (0, 1200 if bit else 400)]
+    return pulses + [(1, 400)], PRESET_AM
+
+
+def pirateproto2_manchester():
+    # tools/host/host_pwm.c: 48 bits at 500us per half bit, 10 is 1. The engine
+    # picks up the phase on a lead 1 after the sync, it isn't part of the data
+    serial, btn, cnt = 0x9E8D7C6, 0x3, 0x1F2E
+    data = (serial << 20) | (btn << 16) | cnt
+    levels = manchester([1] + bits_of(data, 48), [1, 0], [0, 1])
+    return [(1, 3000), (0, 1500)] + runs(levels, 500), PRESET_FM
+
+
+CAPTURES = {
+    "kia_v0": kia_v0,
+    "kia_v1": kia_v1,
+    "kia_v2": kia_v2,
+    "kia_v3": kia_v3,
+    "kia_v4": kia_v4,
+    "kia_v5": kia_v5,
+    "ford_v0": ford_v0,
+    "subaru": subaru,
+    "suzuki": suzuki,
+    "vw": vw,
+    "fiat_v0": fiat_v0,
+    # PWM engine, only the pirateproto2 host builds have these decoders
+    "pirateproto2/pwm": pirateproto2_pwm,
+    "pirateproto2/ppm": pirateproto2_ppm,
+    "pirateproto2/manchester": pirateproto2_manchester,
+}
+
+
+def jitter(pulses, rng, te_min):
+    # A twentieth of the shortest period, well inside every tolerance
+    spread = te_min // 20
+    return [(level, duration + rng.randint(-spread, spread)) for level, duration in pulses]
+
+
+def capture(name, build):
+    frame, preset = build()
+    rng = random.Random(name)
+    te_min = min(duration for _, duration in frame)
+    pulses = [(0, GAP_US)]
+    for _ in range(REPEATS):
+        pulses += jitter(frame, rng, te_min)
+        pulses.append((0, GAP_US))
+
+    values = []
+    for level, duration in pulses:
+        value = duration if level else -duration
+        if values and (values[-1] > 0) == bool(level):
+            values[-1] += value
+        else:
+            values.append(value)
+    return values, preset
+
+
+def write(path, values, preset):
+    with open(path, "w") as out:
+        out.write("Filetype: Flipper SubGhz RAW File\n")
+        out.write("Version: 1\n")
+        out.write("Frequency: %d\n" % FREQUENCY)
+        out.write("Preset: %s\n" % preset)
+        out.write("Protocol: RAW\n")
+        for i in range(0, len(values), RAW_LINE):
+            line = " ".join(str(v) for v in values[i : i + RAW_LINE])
+            out.write("RAW_Data: %s\n" % line)
+
+
+def main():
+    folder = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    for name, build in CAPTURES.items():
+        values, preset = capture(name, build)
+        path = os.path.join(folder, name + ".sub")
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        write(path, values, preset)
+        print("%s.sub: %d values" % (name, len(values)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,126 @@
+// tools/host/fuzz_decoders.c
+#include "host_decoders.h"
+#include "host_cost.h"
+
+// Fuzz target for every decoder's feed(), libFuzzer entry point. For AFL or
+// replaying crashes build it with fuzz_main.c instead, see the Makefile.
+//
+// Input: byte 0 picks the decoder (index mod count, 0xFF feeds all of them
+// the same pulses), then little endian uint16 pulses:
+//   bit 15     level
+//   bit 14     duration in units of 64 us instead of 1 us
+//   bits 0-13  duration, 0 resets the decoder like a worker overrun
+//
+// Besides the sanitizers, a single feed() costing more than the budget
+// aborts: no pulse sequence may stall the worker. The budget excludes the
+// frame callback, which here also runs get_string and serialize.
+
+// Per feed, instructions with perf and ns without. PROTOPIRATE_FEED_BUDGET overrides
+#define FUZZ_BUDGET_INSTRUCTIONS 50000
+#define FUZZ_BUDGET_NS           200000
+
+#define FUZZ_ALL_DECODERS 0xFF
+#define FUZZ_LEVEL        0x8000
+#define FUZZ_SCALED       0x4000
+#define FUZZ_DURATION     0x3FFF
+#define FUZZ_SCALE        64
+
+static uint64_t fuzz_budget;
+
+static void fuzz_frame_callback(HostDecoder* decoder, void* context) {
+    FuriString* text = context;
+    SubGhzRadioPreset preset = {0};
+
+    decoder->protocol->decoder->get_hash_data(decoder->base);
+    furi_string_reset(text);
+    decoder->protocol->decoder->get_string(decoder->base, text);
+    decoder->protocol->decoder->serialize(decoder->base, NULL, &preset);
+}
+
+static void fuzz_init(void) {
+    host_cost_init();
+    const char* budget = getenv("PROTOPIRATE_FEED_BUDGET");
+    if(budget) {
+        fuzz_budget = strtoull(budget, NULL, 0);
+    } else if(!strcmp(host_cost_unit(), "instructions")) {
+        fuzz_budget = FUZZ_BUDGET_INSTRUCTIONS;
+    } else {
+        fuzz_budget = FUZZ_BUDGET_NS;
+    }
+}
+
+static uint16_t fuzz_get_pulse(const uint8_t* data, size_t index, uint32_t* duration) {
+    uint16_t pulse = data[1 + index * 2] | (data[2 + index * 2] << 8);
+    *duration = pulse & FUZZ_DURATION;
+    if(pulse & FUZZ_SCALED) *duration *= FUZZ_SCALE;
+    return pulse;
+}
+
+// Feeds the pulses to a fresh decoder, the first pulse over budget or SIZE_MAX
+static size_t fuzz_run(
+    const SubGhzProtocol* protocol,
+    const uint8_t* data,
+    size_t size,
+    FuriString* text,
+    uint64_t* breach_cost) {
+    HostDecoder* decoder = host_decoder_alloc(protocol, fuzz_frame_callback, text);
+    size_t breach = SIZE_MAX;
+
+    for(size_t index = 0; index < (size - 1) / 2 && breach == SIZE_MAX; index++) {
+        uint32_t duration;
+        uint16_t pulse = fuzz_get_pulse(data, index, &duration);
+
+        if(!duration) {
+            host_decoder_reset(decoder);
+            continue;
+        }
+        uint64_t cost = host_decoder_feed(decoder, pulse & FUZZ_LEVEL, duration);
+        if(cost > fuzz_budget) {
+            breach = index;
+            *breach_cost = cost;
+        }
+    }
+
+    host_decoder_free(decoder);
+    return breach;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if(!fuzz_budget) fuzz_init();
+    if(size < 1) return 0;
+
+    size_t count = host_decoders_get_count();
+    size_t first = data[0] == FUZZ_ALL_DECODERS ? 0 : data[0] % count;
+    size_t last = data[0] == FUZZ_ALL_DECODERS ? count : first + 1;
+    FuriString* text = furi_string_alloc();
+
+    for(size_t index = first; index < last; index++) {
+        const SubGhzProtocol* protocol = host_decoders_get(index);
+        uint64_t cost = 0;
+        size_t breach = fuzz_run(protocol, data, size, text, &cost);
+
+        // Time also catches page faults and cache misses, a real stall repeats
+        if(breach != SIZE_MAX && strcmp(host_cost_unit(), "instructions") &&
+           fuzz_run(protocol, data, size, text, &cost) != breach) {
+            breach = SIZE_MAX;
+        }
+        if(breach != SIZE_MAX) {
+            uint32_t duration;
+            uint16_t pulse = fuzz_get_pulse(data, breach, &duration);
+            fprintf(
+                stderr,
+                "%s: feed of pulse %zu (%s %lu us) cost %llu %s, budget %llu\n",
+                protocol->name,
+                breach,
+                pulse & FUZZ_LEVEL ? "high" : "low",
+                (unsigned long)duration,
+                (unsigned long long)cost,
+                host_cost_unit(),
+                (unsigned long long)fuzz_budget);
+            abort();
+        }
+    }
+
+    furi_string_free(text);
+    return 0;
+}
@@ -0,0 +1,50 @@
+// tools/host/fuzz_main.c
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Runs the fuzz target over files, or stdin without arguments: replays
+// libFuzzer crashes in a plain sanitizer build and is the AFL entry point.
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+static int fuzz_main_run(FILE* file, const char* name) {
+    size_t capacity = 4096;
+    size_t size = 0;
+    uint8_t* data = malloc(capacity);
+
+    size_t read;
+    while(data && (read = fread(data + size, 1, capacity - size, file)) > 0) {
+        size += read;
+        if(size == capacity) {
+            capacity *= 2;
+            data = realloc(data, capacity);
+        }
+    }
+    if(!data || ferror(file)) {
+        fprintf(stderr, "%s: read failed\n", name);
+        free(data);
+        return 1;
+    }
+
+    LLVMFuzzerTestOneInput(data, size);
+    free(data);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) return fuzz_main_run(stdin, "stdin");
+
+    int result = 0;
+    for(int i = 1; i < argc; i++) {
+        FILE* file = fopen(argv[i], "rb");
+        if(!file) {
+            fprintf(stderr, "%s: can't open\n", argv[i]);
+            result = 1;
+            continue;
+        }
+        result |= fuzz_main_run(file, argv[i]);
+        fclose(file);
+    }
+    return result;
+}
@@ -0,0 +1,254 @@
+// tools/host/golden.c
+#include "host_decoders.h"
+#include "host_cost.h"
+#include "host_corpus.h"
+#include "host_raw.h"
+
+// Golden capture regression test. Every <name>.golden in the corpus names a
+// RAW capture, the decoder it was recorded for and that decoder's budget:
+//
+//   Filetype: ProtoPirate Golden
+//   Version: 1
+//   Capture: kia_v0.sub
+//   Decoder: Kia V0
+//   Budget_ns: 20000
+//
+// followed by the frames the registry decoded from it. The capture is fed to
+// every decoder pulse by pulse in registry order, like the receiver does, and
+// each frame is recorded as the pulse index plus what the decoder's serialize
+// writes. Any difference to the file fails. Then the named decoder alone
+// replays the capture GOLDEN_RUNS times, the fastest run divided by its
+// frames is held against Budget_ns.
+//
+//   ./build/golden [-u] [corpus...]
+//
+// -u rewrites the frames of every file from the current decoders and keeps
+// the header. Review the diff before committing it. Without folders it reads
+// host_corpus_default, golden_pirateproto2 adds corpus/pirateproto2.
+//
+// Every decodable protocol of the registry has to be named by a capture or
+// decode frames pinned in one, a decoder without either is unchecked.
+
+#define GOLDEN_RUNS 20
+
+typedef struct {
+    FuriString* text;
+    size_t pulse;
+    uint32_t frames;
+    // Registry decoders that decoded a frame
+    bool* decoded;
+} GoldenReplay;
+
+static void golden_frame_callback(HostDecoder* decoder, void* context) {
+    GoldenReplay* replay = context;
+    FlipperFormat* flipper_format = flipper_format_string_alloc();
+    SubGhzRadioPreset preset = {0};
+
+    decoder->protocol->decoder->serialize(decoder->base, flipper_format, &preset);
+    furi_string_cat_printf(
+        replay->text,
+        HOST_CORPUS_FRAME " %lu\nPulse: %zu\n%s",
+        (unsigned long)replay->frames,
+        replay->pulse,
+        flipper_format_get_text(flipper_format));
+    replay->frames++;
+
+    flipper_format_free(flipper_format);
+}
+
+// Every decoder of the registry, interleaved per pulse
+static void golden_replay(const HostRaw* raw, GoldenReplay* replay) {
+    size_t count = host_decoders_get_count();
+    HostDecoder** decoder = malloc(count * sizeof(HostDecoder*));
+    for(size_t i = 0; i < count; i++) {
+        decoder[i] = host_decoder_alloc(host_decoders_get(i), golden_frame_callback, replay);
+        host_decoder_reset(decoder[i]);
+    }
+
+    for(replay->pulse = 0; replay->pulse < raw->count; replay->pulse++) {
+        for(size_t i = 0; i < count; i++) {
+            host_decoder_feed_raw(decoder[i], &raw->value[replay->pulse], 1);
+        }
+    }
+
+    for(size_t i = 0; i < count; i++) {
+        replay->decoded[i] = decoder[i]->frames;
+        host_decoder_free(decoder[i]);
+    }
+    free(decoder);
+}
+
+// Fastest of GOLDEN_RUNS replays through one decoder, ns per frame
+static bool golden_time(
+    const SubGhzProtocol* protocol,
+    const HostRaw* raw,
+    uint64_t* ns_per_frame) {
+    uint64_t best = UINT64_MAX;
+    uint32_t frames = 0;
+
+    for(uint32_t run = 0; run < GOLDEN_RUNS; run++) {
+        HostDecoder* decoder = host_decoder_alloc(protocol, NULL, NULL);
+        host_decoder_reset(decoder);
+        uint64_t start = host_cost_ns();
+        host_decoder_feed_raw(decoder, raw->value, raw->count);
+        best = MIN(best, host_cost_ns() - start);
+        frames = decoder->frames;
+        host_decoder_free(decoder);
+    }
+
+    if(!frames) return false;
+    *ns_per_frame = best / frames;
+    return true;
+}
+
+static bool golden_write(const char* path, const HostCorpusEntry* golden, const char* body) {
+    FILE* file = fopen(path, "wb");
+    if(!file) return false;
+    bool result = fwrite(golden->text, 1, golden->body, file) == golden->body &&
+                  fputs(body, file) >= 0;
+    return !fclose(file) && result;
+}
+
+// Line of the first difference, 1 based
+static size_t golden_get_diff_line(const char* expected, const char* actual) {
+    size_t line = 1;
+    for(; *expected && *expected == *actual; expected++, actual++) {
+        if(*expected == '\n') line++;
+    }
+    return line;
+}
+
+static bool golden_run(const char* folder, const char* name, bool update, bool* used) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", folder, name);
+
+    HostCorpusEntry golden = {0};
+    bool result = false;
+    HostRaw* raw = NULL;
+    GoldenReplay replay = {
+        .text = furi_string_alloc(),
+        .decoded = calloc(host_decoders_get_count(), sizeof(bool)),
+    };
+
+    do {
+        if(!host_corpus_load(&golden, path)) break;
+
+        const SubGhzProtocol* protocol = host_decoders_find(golden.decoder);
+        if(!protocol) {
+            fprintf(stderr, "%s: no decoder %s in the registry\n", name, golden.decoder);
+            break;
+        }
+        for(size_t i = 0; i < host_decoders_get_count(); i++) {
+            if(host_decoders_get(i) == protocol) used[i] = true;
+        }
+
+        char capture[512];
+        snprintf(capture, sizeof(capture), "%s/%s", folder, golden.capture);
+        raw = host_raw_load(capture);
+        if(!raw) {
+            fprintf(stderr, "%s: no RAW_Data in %s\n", name, capture);
+            break;
+        }
+
+        golden_replay(raw, &replay);
+        const char* actual = furi_string_get_cstr(replay.text);
+        const char* expected = golden.text + golden.body;
+        if(update) {
+            if(!golden_write(path, &golden, actual)) {
+                fprintf(stderr, "%s: can't write\n", name);
+                break;
+            }
+        } else if(strcmp(expected, actual)) {
+            fprintf(
+                stderr,
+                "%s: decode differs from line %zu of the frames, got:\n%s",
+                name,
+                golden_get_diff_line(expected, actual),
+                actual);
+            break;
+        }
+
+        for(size_t i = 0; i < host_decoders_get_count(); i++) {
+            used[i] |= replay.decoded[i];
+        }
+
+        uint64_t ns_per_frame;
+        if(!golden_time(protocol, raw, &ns_per_frame)) {
+            fprintf(stderr, "%s: %s decoded no frame\n", name, golden.decoder);
+            break;
+        }
+        printf(
+            "%s: %lu frames, %s %llu ns/frame (budget %lu)\n",
+            name,
+            (unsigned long)replay.frames,
+            golden.decoder,
+            (unsigned long long)ns_per_frame,
+            (unsigned long)golden.budget_ns);
+        if(ns_per_frame > golden.budget_ns) {
+            fprintf(stderr, "%s: %s over budget\n", name, golden.decoder);
+            break;
+        }
+
+        result = true;
+    } while(false);
+
+    furi_string_free(replay.text);
+    free(replay.decoded);
+    if(raw) host_raw_free(raw);
+    host_corpus_free(&golden);
+    return result;
+}
+
+// The app picks decoders by protocol_list.h before loading them and the firmware
+// furi_checks it on load, this catches a stale entry before flashing
+static uint32_t golden_check_manifest(void) {
+    uint32_t failed = 0;
+#define PROTOPIRATE_PROTOCOL(protocol, plugin_id, protocol_name, protocol_flag, short_us, long_us) \
+    if(strcmp(protocol.name, protocol_name) || protocol.flag != (protocol_flag) ||                \
+       protocol##_const.te_short != (short_us) || protocol##_const.te_long != (long_us)) {        \
+        fprintf(stderr, "%s: protocol_list.h entry doesn't match the decoder\n", protocol_name); \
+        failed++;                                                                                 \
+    }
+#include "../../protocols/protocol_list.h"
+#undef PROTOPIRATE_PROTOCOL
+    return failed;
+}
+
+int main(int argc, char** argv) {
+    bool update = argc > 1 && !strcmp(argv[1], "-u");
+    int first = 1 + update;
+    const char* const* folder =
+        first < argc ? (const char* const*)&argv[first] : host_corpus_default;
+    size_t folder_count = first < argc ? (size_t)(argc - first) : host_corpus_default_count;
+
+    bool* used = calloc(host_decoders_get_count(), sizeof(bool));
+    size_t total = 0;
+    uint32_t failed = golden_check_manifest();
+    for(size_t f = 0; f < folder_count; f++) {
+        size_t count;
+        char** name = host_corpus_list(folder[f], &count);
+        if(!name) {
+            fprintf(stderr, "%s: can't open\n", folder[f]);
+            failed++;
+            continue;
+        }
+        for(size_t i = 0; i < count; i++) {
+            if(!golden_run(folder[f], name[i], update, used)) failed++;
+        }
+        host_corpus_list_free(name, count);
+        total += count;
+    }
+
+    for(size_t i = 0; i < host_decoders_get_count(); i++) {
+        // Registered only to load saved keys, any frame of theirs shows up in a diff
+        bool decodable = host_decoders_get(i)->flag & SubGhzProtocolFlag_Decodable;
+        if(decodable && !used[i]) {
+            fprintf(stderr, "%s: no capture decodes it\n", host_decoders_get(i)->name);
+            failed++;
+        }
+    }
+    free(used);
+
+    printf("%zu captures, %lu failed\n", total, (unsigned long)failed);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+// tools/host/host_corpus.c
+#include "host_corpus.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const char* const host_corpus_default[] = {
+    "corpus",
+#ifdef HOST_PIRATEPROTO2
+    // Captures of the PWM engine's descriptors
+    "corpus/pirateproto2",
+#endif
+};
+const size_t host_corpus_default_count =
+    sizeof(host_corpus_default) / sizeof(host_corpus_default[0]);
+
+static char* host_corpus_read_file(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if(!file) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* text = malloc(size + 1);
+    if(fread(text, 1, size, file) != (size_t)size) {
+        free(text);
+        text = NULL;
+    } else {
+        text[size] = '\0';
+    }
+    fclose(file);
+    return text;
+}
+
+// Copies the value of a "Key: value" header line, false if there is none
+static bool host_corpus_get_value(
+    const HostCorpusEntry* entry,
+    const char* key,
+    char* value,
+    size_t size) {
+    size_t length = strlen(key);
+    for(const char* line = entry->text; line < entry->text + entry->body;) {
+        const char* end = strchr(line, '\n');
+        if(!end) end = line + strlen(line);
+        if(!strncmp(line, key, length) && line[length] == ':') {
+            const char* start = line + length + 1;
+            while(*start == ' ') start++;
+            snprintf(value, size, "%.*s", (int)(end - start), start);
+            return true;
+        }
+        line = *end ? end + 1 : end;
+    }
+    return false;
+}
+
+static int host_corpus_compare_names(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+char** host_corpus_list(const char* folder, size_t* count) {
+    *count = 0;
+    DIR* dir = opendir(folder);
+    if(!dir) return NULL;
+
+    // Sorted for a stable report
+    char** name = NULL;
+    size_t extension = strlen(HOST_CORPUS_EXTENSION);
+    for(struct dirent* entry = readdir(dir); entry; entry = readdir(dir)) {
+        size_t length = strlen(entry->d_name);
+        if(length > extension &&
+           !strcmp(entry->d_name + length - extension, HOST_CORPUS_EXTENSION)) {
+            name = realloc(name, (*count + 1) * sizeof(char*));
+            name[(*count)++] = strdup(entry->d_name);
+        }
+    }
+    closedir(dir);
+    qsort(name, *count, sizeof(char*), host_corpus_compare_names);
+
+    // Not NULL for an empty folder, NULL means it couldn't be opened
+    return name ? name : malloc(sizeof(char*));
+}
+
+void host_corpus_list_free(char** name, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        free(name[i]);
+    }
+    free(name);
+}
+
+bool host_corpus_load(HostCorpusEntry* entry, const char* path) {
+    entry->text = host_corpus_read_file(path);
+    if(!entry->text) {
+        fprintf(stderr, "%s: can't read\n", path);
+        return false;
+    }
+
+    const char* frame = strstr(entry->text, "\n" HOST_CORPUS_FRAME);
+    entry->body = frame ? (size_t)(frame + 1 - entry->text) : strlen(entry->text);
+
+    char budget[16];
+    if(!host_corpus_get_value(entry, "Capture", entry->capture, sizeof(entry->capture)) ||
+       !host_corpus_get_value(entry, "Decoder", entry->decoder, sizeof(entry->decoder)) ||
+       !host_corpus_get_value(entry, "Budget_ns", budget, sizeof(budget))) {
+        fprintf(stderr, "%s: needs Capture, Decoder and Budget_ns\n", path);
+        return false;
+    }
+    entry->budget_ns = strtoul(budget, NULL, 10);
+    return true;
+}
+
+void host_corpus_free(HostCorpusEntry* entry) {
+    free(entry->text);
+    entry->text = NULL;
+}
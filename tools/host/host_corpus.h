@@ -0,0 +1,35 @@
+// tools/host/host_corpus.h
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define HOST_CORPUS_EXTENSION ".golden"
+#define HOST_CORPUS_FRAME     "Frame:"
+
+/**
+ * A <name>.golden file of the capture corpus: a header naming the RAW
+ * capture, the decoder it was recorded for and that decoder's budget,
+ * then the frames expected from it, see golden.c.
+ */
+typedef struct {
+    char* text;
+    // Start of the first frame, the header ends here
+    size_t body;
+    char capture[256];
+    char decoder[64];
+    uint32_t budget_ns;
+} HostCorpusEntry;
+
+/** Folders golden and bench read without arguments, the captures of this registry */
+extern const char* const host_corpus_default[];
+extern const size_t host_corpus_default_count;
+
+/** Names of the .golden files in folder, sorted, free with host_corpus_list_free() */
+char** host_corpus_list(const char* folder, size_t* count);
+void host_corpus_list_free(char** name, size_t count);
+
+/** Reads the file and its header, prints why it can't and returns false */
+bool host_corpus_load(HostCorpusEntry* entry, const char* path);
+void host_corpus_free(HostCorpusEntry* entry);
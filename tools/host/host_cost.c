@@ -0,0 +1,46 @@
+// tools/host/host_cost.c
+#include "host_cost.h"
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+static int host_cost_fd = -1;
+
+void host_cost_init(void) {
+    if(host_cost_fd >= 0) return;
+
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    host_cost_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if(host_cost_fd >= 0) {
+        ioctl(host_cost_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(host_cost_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+const char* host_cost_unit(void) {
+    return host_cost_fd >= 0 ? "instructions" : "ns";
+}
+
+uint64_t host_cost_now(void) {
+    if(host_cost_fd >= 0) {
+        uint64_t count;
+        if(read(host_cost_fd, &count, sizeof(count)) == sizeof(count)) return count;
+    }
+    return host_cost_ns();
+}
+
+uint64_t host_cost_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
@@ -0,0 +1,24 @@
+// tools/host/host_cost.h
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Cost of a stretch of code on the host.
+ *
+ * Counts retired user-space instructions through perf when the kernel allows
+ * it (perf_event_paranoid <= 2 or CAP_PERFMON), which is stable from run to
+ * run and close to what the Cortex-M4 executes. Falls back to nanoseconds of
+ * thread CPU time otherwise, see host_cost_unit(): time the thread spent
+ * descheduled doesn't count, page faults and cache misses still do.
+ */
+void host_cost_init(void);
+
+/** "instructions" or "ns" */
+const char* host_cost_unit(void);
+
+uint64_t host_cost_now(void);
+
+/** Thread CPU time, for budgets stated in time whatever host_cost_unit() is */
+uint64_t host_cost_ns(void);
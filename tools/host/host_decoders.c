@@ -0,0 +1,97 @@
+// tools/host/host_decoders.c
+#include "host_decoders.h"
+#include "host_cost.h"
+
+#ifdef HOST_PIRATEPROTO2
+#include "host_pwm.h"
+#include "../../pirateproto2/protocols/protocol_items.h"
+
+// pirateproto2's registry, the shared decoders included, then the engine's extra codings
+#define HOST_REGISTRY pirateproto2_protocol_registry
+#define HOST_EXTRA host_pwm_protocols
+#define HOST_EXTRA_COUNT host_pwm_protocol_count
+#else
+#define HOST_REGISTRY protopirate_protocol_registry
+#define HOST_EXTRA ((const SubGhzProtocol* const*)NULL)
+#define HOST_EXTRA_COUNT ((size_t)0)
+#endif
+
+size_t host_decoders_get_count(void) {
+    return HOST_REGISTRY.size + HOST_EXTRA_COUNT;
+}
+
+const SubGhzProtocol* host_decoders_get(size_t index) {
+    furi_check(index < host_decoders_get_count());
+    if(index < HOST_REGISTRY.size) return HOST_REGISTRY.items[index];
+    return HOST_EXTRA[index - HOST_REGISTRY.size];
+}
+
+const SubGhzProtocol* host_decoders_find(const char* name) {
+    for(size_t i = 0; i < host_decoders_get_count(); i++) {
+        if(!strcmp(host_decoders_get(i)->name, name)) return host_decoders_get(i);
+    }
+    return NULL;
+}
+
+static void host_decoder_rx_callback(SubGhzProtocolDecoderBase* base, void* context) {
+    UNUSED(base);
+    HostDecoder* decoder = context;
+    uint64_t start = host_cost_now();
+
+    decoder->frames++;
+    if(decoder->callback) {
+        decoder->callback(decoder, decoder->context);
+    }
+
+    decoder->callback_cost += host_cost_now() - start;
+}
+
+HostDecoder* host_decoder_alloc(
+    const SubGhzProtocol* protocol,
+    HostDecoderFrameCallback callback,
+    void* context) {
+    furi_check(protocol->decoder);
+    HostDecoder* decoder = malloc(sizeof(HostDecoder));
+    decoder->protocol = protocol;
+    decoder->base = protocol->decoder->alloc(NULL);
+    decoder->base->callback = host_decoder_rx_callback;
+    decoder->base->context = decoder;
+    decoder->callback = callback;
+    decoder->context = context;
+    host_cost_init();
+    return decoder;
+}
+
+void host_decoder_free(HostDecoder* decoder) {
+    decoder->protocol->decoder->free(decoder->base);
+    free(decoder);
+}
+
+uint64_t host_decoder_feed(HostDecoder* decoder, bool level, uint32_t duration) {
+    decoder->callback_cost = 0;
+    uint64_t start = host_cost_now();
+    decoder->protocol->decoder->feed(decoder->base, level, duration);
+    uint64_t cost = host_cost_now() - start;
+    cost = cost > decoder->callback_cost ? cost - decoder->callback_cost : 0;
+
+    decoder->feeds++;
+    decoder->cost_sum += cost;
+    decoder->cost_max = MAX(decoder->cost_max, cost);
+    return cost;
+}
+
+void host_decoder_feed_raw(HostDecoder* decoder, const int32_t* raw, size_t count) {
+    const SubGhzProtocolDecoder* protocol_decoder = decoder->protocol->decoder;
+    for(size_t i = 0; i < count; i++) {
+        protocol_decoder->feed(decoder->base, raw[i] > 0, raw[i] > 0 ? raw[i] : -raw[i]);
+    }
+    decoder->feeds += count;
+}
+
+void host_decoder_reset(HostDecoder* decoder) {
+    decoder->protocol->decoder->reset(decoder->base);
+}
+
+const SubGhzBlockGeneric* host_decoder_get_generic(HostDecoder* decoder) {
+    return &((ProtoPirateDecoderHead*)decoder->base)->generic;
+}
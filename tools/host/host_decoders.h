@@ -0,0 +1,55 @@
+// tools/host/host_decoders.h
+#pragma once
+
+#include "../../protocols/protocol_items.h"
+#include "../../protocols/protocol_stats.h"
+
+typedef struct HostDecoder HostDecoder;
+
+/** A frame reached the receiver callback, the decoder's generic block holds it */
+typedef void (*HostDecoderFrameCallback)(HostDecoder* decoder, void* context);
+
+/**
+ * One decoder of protocols/ driven the way the app's dispatch drives it,
+ * with the cost of every feed() measured by host_cost. Work done in the
+ * frame callback is not billed to the feed that triggered it.
+ */
+struct HostDecoder {
+    const SubGhzProtocol* protocol;
+    SubGhzProtocolDecoderBase* base;
+    HostDecoderFrameCallback callback;
+    void* context;
+
+    uint32_t frames;
+    uint64_t feeds;
+    uint64_t cost_sum;
+    uint64_t cost_max;
+    // Cost of the callback inside the feed being measured
+    uint64_t callback_cost;
+};
+
+/**
+ * Protocols in the registry, protocol_config.h decides which. Builds with
+ * HOST_PIRATEPROTO2 run pirateproto2's registry plus host_pwm.h instead.
+ */
+size_t host_decoders_get_count(void);
+const SubGhzProtocol* host_decoders_get(size_t index);
+/** NULL if the name isn't in the registry */
+const SubGhzProtocol* host_decoders_find(const char* name);
+
+HostDecoder* host_decoder_alloc(
+    const SubGhzProtocol* protocol,
+    HostDecoderFrameCallback callback,
+    void* context);
+void host_decoder_free(HostDecoder* decoder);
+
+/** @return cost of this feed, host_cost_unit() */
+uint64_t host_decoder_feed(HostDecoder* decoder, bool level, uint32_t duration);
+
+/** Feeds signed RAW durations (high positive) without measuring each feed */
+void host_decoder_feed_raw(HostDecoder* decoder, const int32_t* raw, size_t count);
+
+/** What the worker does on an overrun */
+void host_decoder_reset(HostDecoder* decoder);
+
+const SubGhzBlockGeneric* host_decoder_get_generic(HostDecoder* decoder);
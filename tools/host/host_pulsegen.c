@@ -0,0 +1,160 @@
+// tools/host/host_pulsegen.c
+#include "host_pulsegen.h"
+
+#include <furi.h>
+
+// Shortest pulse the generator emits, the radio doesn't report less
+#define PULSEGEN_DURATION_MIN 10
+// Longest stretch of highs a dropout loses, us
+#define PULSEGEN_DROPOUT_MAX 2000
+
+// EV1527 style remote: sync of 1 + 31 te, 24 bits of 1:3 or 3:1 te
+#define PULSEGEN_TRAFFIC_TE_MIN 250
+#define PULSEGEN_TRAFFIC_TE_MAX 500
+#define PULSEGEN_TRAFFIC_BITS   24
+#define PULSEGEN_TRAFFIC_SYNC   31
+
+struct HostPulseGen {
+    HostPulseGenConfig config;
+    uint32_t state;
+    HostRaw* stream;
+    uint64_t time;
+};
+
+HostPulseGen* host_pulsegen_alloc(const HostPulseGenConfig* config) {
+    HostPulseGen* gen = malloc(sizeof(HostPulseGen));
+    gen->config = *config;
+    // xorshift32 never leaves 0
+    gen->state = config->seed ? config->seed : 1;
+    gen->stream = host_raw_alloc();
+    gen->time = 0;
+    return gen;
+}
+
+void host_pulsegen_free(HostPulseGen* gen) {
+    host_raw_free(gen->stream);
+    free(gen);
+}
+
+// 0 to range - 1, the same sequence on every host
+static uint32_t host_pulsegen_random(HostPulseGen* gen, uint32_t range) {
+    gen->state ^= gen->state << 13;
+    gen->state ^= gen->state >> 17;
+    gen->state ^= gen->state << 5;
+    return range ? gen->state % range : 0;
+}
+
+// -spread to spread
+static int32_t host_pulsegen_spread(HostPulseGen* gen, uint32_t spread) {
+    return (int32_t)host_pulsegen_random(gen, 2 * spread + 1) - (int32_t)spread;
+}
+
+static void host_pulsegen_push(HostPulseGen* gen, bool level, int64_t duration) {
+    duration = MAX(duration, (int64_t)PULSEGEN_DURATION_MIN);
+    host_raw_push(gen->stream, level, duration);
+    gen->time += duration;
+}
+
+// A pulse as the receiver sees it, maybe split by a noise spike
+static void host_pulsegen_push_received(HostPulseGen* gen, bool level, int64_t duration) {
+    const HostPulseGenConfig* config = &gen->config;
+    duration += host_pulsegen_spread(gen, config->jitter);
+
+    uint32_t spike = 1 + host_pulsegen_random(gen, config->noise_max);
+    if(host_pulsegen_random(gen, 1000) < config->glitch_permille && duration > 2 * spike) {
+        int64_t before = host_pulsegen_random(gen, duration - spike);
+        host_pulsegen_push(gen, level, before);
+        host_pulsegen_push(gen, !level, spike);
+        host_pulsegen_push(gen, level, duration - spike - before);
+    } else {
+        host_pulsegen_push(gen, level, duration);
+    }
+}
+
+void host_pulsegen_add_idle(HostPulseGen* gen) {
+    const HostPulseGenConfig* config = &gen->config;
+    uint32_t idle = config->idle_min +
+                    host_pulsegen_random(gen, config->idle_max - config->idle_min + 1);
+    if(host_pulsegen_random(gen, 100) < config->long_idle_percent) {
+        idle = config->long_idle;
+    }
+
+    if(!config->noise_rate) {
+        host_pulsegen_push(gen, false, idle);
+        return;
+    }
+    // Spikes at random, noise_rate per second on average
+    uint32_t mean_gap = 1000000 / config->noise_rate;
+    for(uint32_t time = 0; time < idle;) {
+        uint32_t gap = MIN(1 + host_pulsegen_random(gen, 2 * mean_gap), idle - time);
+        host_pulsegen_push(gen, false, gap);
+        time += gap;
+        if(time < idle) {
+            uint32_t spike = 1 + host_pulsegen_random(gen, config->noise_max);
+            host_pulsegen_push(gen, true, spike);
+            time += spike;
+        }
+    }
+    // Always end low, the next transmission starts with a high
+    host_pulsegen_push(gen, false, PULSEGEN_DURATION_MIN);
+}
+
+// An unrelated remote on the same band, a few repeats of a random code
+static void host_pulsegen_add_traffic(HostPulseGen* gen) {
+    uint32_t te = PULSEGEN_TRAFFIC_TE_MIN +
+                  host_pulsegen_random(gen, PULSEGEN_TRAFFIC_TE_MAX - PULSEGEN_TRAFFIC_TE_MIN);
+    uint32_t code = host_pulsegen_random(gen, 1 << PULSEGEN_TRAFFIC_BITS);
+    uint32_t repeats = 4 + host_pulsegen_random(gen, 5);
+
+    for(uint32_t repeat = 0; repeat < repeats; repeat++) {
+        host_pulsegen_push_received(gen, true, te);
+        host_pulsegen_push_received(gen, false, te * PULSEGEN_TRAFFIC_SYNC);
+        for(int32_t bit = PULSEGEN_TRAFFIC_BITS - 1; bit >= 0; bit--) {
+            bool one = (code >> bit) & 1;
+            host_pulsegen_push_received(gen, true, one ? 3 * te : te);
+            host_pulsegen_push_received(gen, false, one ? te : 3 * te);
+        }
+    }
+    host_pulsegen_add_idle(gen);
+}
+
+HostPulseGenMark host_pulsegen_add_burst(HostPulseGen* gen, const HostRaw* burst, size_t source) {
+    const HostPulseGenConfig* config = &gen->config;
+
+    host_pulsegen_add_idle(gen);
+    if(host_pulsegen_random(gen, 100) < config->traffic_percent) {
+        host_pulsegen_add_traffic(gen);
+    }
+
+    // Highs from here on are lost until the dropout's time is used up
+    size_t dropout = SIZE_MAX;
+    uint32_t dropout_left = 0;
+    if(host_pulsegen_random(gen, 100) < config->dropout_percent) {
+        dropout = host_pulsegen_random(gen, burst->count);
+        dropout_left = 1 + host_pulsegen_random(gen, PULSEGEN_DROPOUT_MAX);
+    }
+    int32_t drift = host_pulsegen_spread(gen, config->drift_permille);
+
+    HostPulseGenMark mark = {.start = gen->stream->count, .source = source};
+    for(size_t i = 0; i < burst->count; i++) {
+        bool level = burst->value[i] > 0;
+        int64_t duration = level ? burst->value[i] : -(int64_t)burst->value[i];
+        duration = duration * (1000 + drift) / 1000;
+
+        if(i >= dropout && dropout_left) {
+            dropout_left = duration < dropout_left ? dropout_left - duration : 0;
+            level = false;
+        }
+        host_pulsegen_push_received(gen, level, duration);
+    }
+    mark.end = gen->stream->count;
+    return mark;
+}
+
+const HostRaw* host_pulsegen_get_stream(HostPulseGen* gen) {
+    return gen->stream;
+}
+
+uint64_t host_pulsegen_get_time(HostPulseGen* gen) {
+    return gen->time;
+}
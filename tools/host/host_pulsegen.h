@@ -0,0 +1,61 @@
+// tools/host/host_pulsegen.h
+#pragma once
+
+#include "host_raw.h"
+
+/**
+ * Receive-side pulse stream generator for decoder stress runs.
+ *
+ * Builds what the radio hands the worker on a busy band: idle stretches
+ * with a noise floor of random spikes, unrelated OOK remotes, and known
+ * bursts (corpus captures) distorted the way a real receiver sees them:
+ * per-pulse jitter, a transmitter clock that is off by a fixed amount,
+ * glitches splitting pulses and dropouts losing highs. The stream is fully
+ * determined by the config, the seed included.
+ */
+typedef struct {
+    uint32_t seed;
+    // Idle before every transmission, us
+    uint32_t idle_min;
+    uint32_t idle_max;
+    // Chance of a long idle instead, percent, and its length in us
+    uint8_t long_idle_percent;
+    uint32_t long_idle;
+    // Noise floor: spikes per second of idle, each up to noise_max us high
+    uint32_t noise_rate;
+    uint32_t noise_max;
+    // Chance per burst pulse of a noise spike splitting it, permille
+    uint16_t glitch_permille;
+    // Every pulse moves by up to this many us either way
+    uint32_t jitter;
+    // Every transmission's clock is off by up to this much, permille
+    uint16_t drift_permille;
+    // Chance per burst of losing up to 2ms of highs, percent
+    uint8_t dropout_percent;
+    // Chance before every burst of an unrelated OOK remote, percent
+    uint8_t traffic_percent;
+} HostPulseGenConfig;
+
+/** Where a burst landed in the stream */
+typedef struct {
+    // Pulse indexes, end is exclusive
+    size_t start;
+    size_t end;
+    // What the caller passed with the burst
+    size_t source;
+} HostPulseGenMark;
+
+typedef struct HostPulseGen HostPulseGen;
+
+HostPulseGen* host_pulsegen_alloc(const HostPulseGenConfig* config);
+void host_pulsegen_free(HostPulseGen* gen);
+
+/** Idle, maybe an OOK remote, then the burst under the configured conditions */
+HostPulseGenMark host_pulsegen_add_burst(HostPulseGen* gen, const HostRaw* burst, size_t source);
+
+/** Idle at the end, the last burst's frames need the gap after them */
+void host_pulsegen_add_idle(HostPulseGen* gen);
+
+const HostRaw* host_pulsegen_get_stream(HostPulseGen* gen);
+/** Length of the stream in us */
+uint64_t host_pulsegen_get_time(HostPulseGen* gen);
@@ -0,0 +1,98 @@
+// tools/host/host_pwm.c
+#include "host_pwm.h"
+
+// 64-bit remote: 8 preamble pairs, a 500/1000us sync, the bit in the length of the high
+static const PirateProto2PwmDescriptor host_pwm_pwm_descriptor = {
+    .protocol = &host_pwm_pwm_protocol,
+    .timing =
+        {
+            .te_short = 250,
+            .te_long = 500,
+            .te_delta = 100,
+            .min_count_bit_for_found = 64,
+        },
+    .preamble_count = 8,
+    .sync_high = 500,
+    .sync_low = 1000,
+    .coding = PirateProto2PwmCodingPwm,
+    .gap = 2000,
+    .serial = {.start = 0, .length = 32},
+    .btn = {.start = 32, .length = 8},
+    .cnt = {.start = 40, .length = 24},
+};
+
+// 40-bit remote: 12 preamble pairs, an 800/2000us sync, te_short high then the bit in the low
+static const PirateProto2PwmDescriptor host_pwm_ppm_descriptor = {
+    .protocol = &host_pwm_ppm_protocol,
+    .timing =
+        {
+            .te_short = 400,
+            .te_long = 1200,
+            .te_delta = 150,
+            .min_count_bit_for_found = 40,
+        },
+    .preamble_count = 12,
+    .sync_high = 800,
+    .sync_low = 2000,
+    .coding = PirateProto2PwmCodingPpm,
+    .gap = 4000,
+    .serial = {.start = 0, .length = 24},
+    .btn = {.start = 24, .length = 4},
+    .cnt = {.start = 28, .length = 12},
+};
+
+// 48-bit remote, Manchester at 500us per half bit after a long sync
+static const PirateProto2PwmDescriptor host_pwm_manchester_descriptor = {
+    .protocol = &host_pwm_manchester_protocol,
+    .timing =
+        {
+            .te_short = 500,
+            .te_long = 1000,
+            .te_delta = 150,
+            .min_count_bit_for_found = 48,
+        },
+    .preamble_count = 0,
+    .sync_high = 3000,
+    .sync_low = 1500,
+    .coding = PirateProto2PwmCodingManchester,
+    .gap = 4000,
+    .serial = {.start = 0, .length = 28},
+    .btn = {.start = 28, .length = 4},
+    .cnt = {.start = 32, .length = 16},
+};
+
+PIRATEPROTO2_PWM_PROTOCOL(host_pwm_pwm, host_pwm_pwm_descriptor)
+PIRATEPROTO2_PWM_PROTOCOL(host_pwm_ppm, host_pwm_ppm_descriptor)
+PIRATEPROTO2_PWM_PROTOCOL(host_pwm_manchester, host_pwm_manchester_descriptor)
+
+const SubGhzProtocol host_pwm_pwm_protocol = {
+    .name = HOST_PWM_PWM_NAME,
+    .type = SubGhzProtocolTypeStatic,
+    .flag = SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable,
+    .decoder = &host_pwm_pwm_decoder,
+    .encoder = &subghz_protocol_pwm_encoder,
+};
+
+const SubGhzProtocol host_pwm_ppm_protocol = {
+    .name = HOST_PWM_PPM_NAME,
+    .type = SubGhzProtocolTypeStatic,
+    .flag = SubGhzProtocolFlag_433 | SubGhzProtocolFlag_AM | SubGhzProtocolFlag_Decodable,
+    .decoder = &host_pwm_ppm_decoder,
+    .encoder = &subghz_protocol_pwm_encoder,
+};
+
+const SubGhzProtocol host_pwm_manchester_protocol = {
+    .name = HOST_PWM_MANCHESTER_NAME,
+    .type = SubGhzProtocolTypeStatic,
+    .flag = SubGhzProtocolFlag_433 | SubGhzProtocolFlag_FM | SubGhzProtocolFlag_Decodable,
+    .decoder = &host_pwm_manchester_decoder,
+    .encoder = &subghz_protocol_pwm_encoder,
+};
+
+const SubGhzProtocol* const host_pwm_protocols[] = {
+    &host_pwm_pwm_protocol,
+    &host_pwm_ppm_protocol,
+    &host_pwm_manchester_protocol,
+};
+
+const size_t host_pwm_protocol_count = COUNT_OF(host_pwm_protocols);
@@ -0,0 +1,20 @@
+// tools/host/host_pwm.h
+#pragma once
+
+#include "pwm_protocol.h"
+
+// Descriptors for the pirateproto2 PWM engine's codings, no shipped protocol
+// has a framing confirmed from captures yet. They join the registry in the
+// pirateproto2 host builds so the fuzzer, golden corpus and bench cover
+// every path through the engine.
+
+#define HOST_PWM_PWM_NAME        "Engine PWM"
+#define HOST_PWM_PPM_NAME        "Engine PPM"
+#define HOST_PWM_MANCHESTER_NAME "Engine Manchester"
+
+extern const SubGhzProtocol host_pwm_pwm_protocol;
+extern const SubGhzProtocol host_pwm_ppm_protocol;
+extern const SubGhzProtocol host_pwm_manchester_protocol;
+
+extern const SubGhzProtocol* const host_pwm_protocols[];
+extern const size_t host_pwm_protocol_count;
@@ -0,0 +1,84 @@
+// tools/host/host_raw.c
+#include "host_raw.h"
+
+#include <furi.h>
+
+#define HOST_RAW_KEY "RAW_Data:"
+// Values per line, same as the Sub-GHz app writes
+#define HOST_RAW_LINE 512
+
+HostRaw* host_raw_alloc(void) {
+    return malloc(sizeof(HostRaw));
+}
+
+void host_raw_free(HostRaw* raw) {
+    free(raw->value);
+    free(raw);
+}
+
+static void host_raw_append(HostRaw* raw, int32_t value) {
+    if(raw->count == raw->capacity) {
+        raw->capacity = MAX(raw->capacity * 2, (size_t)1024);
+        raw->value = realloc(raw->value, raw->capacity * sizeof(int32_t));
+        furi_check(raw->value);
+    }
+    raw->value[raw->count++] = value;
+}
+
+void host_raw_push(HostRaw* raw, bool level, uint32_t duration) {
+    int32_t value = level ? (int32_t)duration : -(int32_t)duration;
+    if(raw->count && (raw->value[raw->count - 1] > 0) == level) {
+        raw->value[raw->count - 1] += value;
+    } else {
+        host_raw_append(raw, value);
+    }
+}
+
+HostRaw* host_raw_load(const char* path) {
+    FILE* file = fopen(path, "r");
+    if(!file) return NULL;
+
+    HostRaw* raw = host_raw_alloc();
+    char* line = NULL;
+    size_t size = 0;
+    while(getline(&line, &size, file) > 0) {
+        if(strncmp(line, HOST_RAW_KEY, strlen(HOST_RAW_KEY))) continue;
+
+        char* cursor = line + strlen(HOST_RAW_KEY);
+        while(true) {
+            char* end;
+            long value = strtol(cursor, &end, 10);
+            if(end == cursor) break;
+            // Recordings may repeat a level across lines, fold as the radio would
+            if(value) host_raw_push(raw, value > 0, value > 0 ? value : -value);
+            cursor = end;
+        }
+    }
+
+    free(line);
+    fclose(file);
+    if(!raw->count) {
+        host_raw_free(raw);
+        return NULL;
+    }
+    return raw;
+}
+
+bool host_raw_save(const HostRaw* raw, const char* path, uint32_t frequency, const char* preset) {
+    FILE* file = fopen(path, "w");
+    if(!file) return false;
+
+    fprintf(
+        file,
+        "Filetype: Flipper SubGhz RAW File\nVersion: 1\nFrequency: %lu\nPreset: %s\n"
+        "Protocol: RAW\n",
+        (unsigned long)frequency,
+        preset);
+    for(size_t i = 0; i < raw->count; i++) {
+        fprintf(file, i % HOST_RAW_LINE ? " %ld" : "RAW_Data: %ld", (long)raw->value[i]);
+        if(i % HOST_RAW_LINE == HOST_RAW_LINE - 1 || i == raw->count - 1) fputc('\n', file);
+    }
+
+    bool result = !ferror(file);
+    return !fclose(file) && result;
+}
@@ -0,0 +1,31 @@
+// tools/host/host_raw.h
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A pulse train as Sub-GHz RAW files store it: signed durations in us,
+ * high positive and low negative.
+ */
+typedef struct {
+    int32_t* value;
+    size_t count;
+    size_t capacity;
+} HostRaw;
+
+HostRaw* host_raw_alloc(void);
+void host_raw_free(HostRaw* raw);
+
+/** Appends a pulse, one of the same level as the last is folded into it */
+void host_raw_push(HostRaw* raw, bool level, uint32_t duration);
+
+/** RAW_Data of a Flipper SubGhz RAW File, NULL if there is none */
+HostRaw* host_raw_load(const char* path);
+
+/**
+ * Writes a Flipper SubGhz RAW File the Sub-GHz app and sim scripts replay,
+ * preset is a FuriHalSubGhzPreset name
+ */
+bool host_raw_save(const HostRaw* raw, const char* path, uint32_t frequency, const char* preset);
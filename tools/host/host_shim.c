@@ -0,0 +1,266 @@
+// tools/host/host_shim.c
+#include <furi.h>
+#include <furi_hal.h>
+#include <flipper_format/flipper_format.h>
+#include <lib/subghz/blocks/decoder.h>
+#include <lib/subghz/blocks/generic.h>
+#include <lib/toolbox/manchester_decoder.h>
+
+#include <time.h>
+
+#undef malloc
+
+void host_crash(const char* file, int line, const char* expression) {
+    fprintf(stderr, "furi_check failed: %s at %s:%d\n", expression, file, line);
+    abort();
+}
+
+void* host_malloc(size_t size) {
+    void* memory = calloc(1, size ? size : 1);
+    furi_check(memory);
+    return memory;
+}
+
+uint32_t furi_get_tick(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000UL + now.tv_nsec / 1000000UL;
+}
+
+uint32_t furi_kernel_get_tick_frequency(void) {
+    return 1000;
+}
+
+uint32_t furi_ms_to_ticks(uint32_t ms) {
+    return ms;
+}
+
+static HostDwt host_dwt;
+HostDwt* DWT = &host_dwt;
+
+uint32_t furi_hal_cortex_instructions_per_microsecond(void) {
+    return 64;
+}
+
+struct FuriString {
+    char* data;
+    size_t length;
+    size_t capacity;
+};
+
+static void furi_string_reserve(FuriString* string, size_t length) {
+    if(length + 1 <= string->capacity) return;
+    string->capacity = MAX(length + 1, string->capacity * 2);
+    string->data = realloc(string->data, string->capacity);
+    furi_check(string->data);
+}
+
+FuriString* furi_string_alloc(void) {
+    FuriString* string = host_malloc(sizeof(FuriString));
+    furi_string_reserve(string, 15);
+    string->data[0] = '\0';
+    return string;
+}
+
+void furi_string_free(FuriString* string) {
+    free(string->data);
+    free(string);
+}
+
+void furi_string_reset(FuriString* string) {
+    string->length = 0;
+    string->data[0] = '\0';
+}
+
+void furi_string_set(FuriString* string, const char* source) {
+    furi_string_reset(string);
+    furi_string_cat_str(string, source);
+}
+
+const char* furi_string_get_cstr(const FuriString* string) {
+    return string->data;
+}
+
+bool furi_string_equal(const FuriString* string, const char* cstr) {
+    return strcmp(string->data, cstr) == 0;
+}
+
+void furi_string_cat_str(FuriString* string, const char* cstr) {
+    size_t length = strlen(cstr);
+    furi_string_reserve(string, string->length + length);
+    memcpy(string->data + string->length, cstr, length + 1);
+    string->length += length;
+}
+
+static void furi_string_cat_vprintf(FuriString* string, const char* format, va_list args) {
+    va_list copy;
+    va_copy(copy, args);
+    int length = vsnprintf(NULL, 0, format, copy);
+    va_end(copy);
+    furi_check(length >= 0);
+
+    furi_string_reserve(string, string->length + length);
+    vsnprintf(string->data + string->length, length + 1, format, args);
+    string->length += length;
+}
+
+void furi_string_cat_printf(FuriString* string, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    furi_string_cat_vprintf(string, format, args);
+    va_end(args);
+}
+
+void furi_string_printf(FuriString* string, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    furi_string_reset(string);
+    furi_string_cat_vprintf(string, format, args);
+    va_end(args);
+}
+
+bool furi_record_exists(const char* name) {
+    UNUSED(name);
+    return false;
+}
+
+void* furi_record_open(const char* name) {
+    furi_crash(name);
+    return NULL;
+}
+
+void furi_record_close(const char* name) {
+    UNUSED(name);
+}
+
+bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
+    UNUSED(flipper_format);
+    UNUSED(key);
+    UNUSED(data);
+    return false;
+}
+
+bool flipper_format_read_uint32(
+    FlipperFormat* flipper_format,
+    const char* key,
+    uint32_t* data,
+    uint16_t data_size) {
+    UNUSED(flipper_format);
+    UNUSED(key);
+    UNUSED(data);
+    UNUSED(data_size);
+    return false;
+}
+
+struct FlipperFormat {
+    FuriString* text;
+};
+
+FlipperFormat* flipper_format_string_alloc(void) {
+    FlipperFormat* flipper_format = host_malloc(sizeof(FlipperFormat));
+    flipper_format->text = furi_string_alloc();
+    return flipper_format;
+}
+
+void flipper_format_free(FlipperFormat* flipper_format) {
+    furi_string_free(flipper_format->text);
+    free(flipper_format);
+}
+
+const char* flipper_format_get_text(FlipperFormat* flipper_format) {
+    return furi_string_get_cstr(flipper_format->text);
+}
+
+bool flipper_format_write_uint32(
+    FlipperFormat* flipper_format,
+    const char* key,
+    const uint32_t* data,
+    uint16_t data_size) {
+    if(!flipper_format) return true;
+    furi_string_cat_printf(flipper_format->text, "%s:", key);
+    for(uint16_t i = 0; i < data_size; i++) {
+        furi_string_cat_printf(flipper_format->text, " %lu", (unsigned long)data[i]);
+    }
+    furi_string_cat_str(flipper_format->text, "\n");
+    return true;
+}
+
+// lib/subghz/blocks/generic.c without Frequency and Preset, the host has no radio
+SubGhzProtocolStatus subghz_block_generic_serialize(
+    SubGhzBlockGeneric* instance,
+    FlipperFormat* flipper_format,
+    SubGhzRadioPreset* preset) {
+    UNUSED(preset);
+    if(!flipper_format) return SubGhzProtocolStatusOk;
+
+    uint32_t bit = instance->data_count_bit;
+    furi_string_cat_printf(flipper_format->text, "Protocol: %s\n", instance->protocol_name);
+    flipper_format_write_uint32(flipper_format, "Bit", &bit, 1);
+    furi_string_cat_str(flipper_format->text, "Key:");
+    for(int shift = 56; shift >= 0; shift -= 8) {
+        furi_string_cat_printf(
+            flipper_format->text, " %02X", (unsigned)(instance->data >> shift) & 0xFF);
+    }
+    furi_string_cat_str(flipper_format->text, "\n");
+    return SubGhzProtocolStatusOk;
+}
+
+SubGhzProtocolStatus
+    subghz_block_generic_deserialize(SubGhzBlockGeneric* instance, FlipperFormat* flipper_format) {
+    UNUSED(instance);
+    UNUSED(flipper_format);
+    return SubGhzProtocolStatusError;
+}
+
+SubGhzProtocolStatus subghz_block_generic_deserialize_check_count_bit(
+    SubGhzBlockGeneric* instance,
+    FlipperFormat* flipper_format,
+    uint16_t count_bit) {
+    UNUSED(count_bit);
+    return subghz_block_generic_deserialize(instance, flipper_format);
+}
+
+// Same as lib/subghz/blocks/decoder.c
+void subghz_protocol_blocks_add_bit(SubGhzBlockDecoder* decoder, uint8_t bit) {
+    decoder->decode_data = decoder->decode_data << 1 | bit;
+    decoder->decode_count_bit++;
+}
+
+uint8_t subghz_protocol_blocks_get_hash_data(SubGhzBlockDecoder* decoder, size_t len) {
+    uint8_t hash = 0;
+    uint8_t* p = (uint8_t*)&decoder->decode_data;
+    for(size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+    }
+    return hash;
+}
+
+// Same as lib/toolbox/manchester_decoder.c
+static const uint8_t manchester_transitions[] = {0x01, 0x91, 0x9B, 0xFB};
+
+bool manchester_advance(
+    ManchesterState state,
+    ManchesterEvent event,
+    ManchesterState* next_state,
+    bool* data) {
+    bool result = false;
+    ManchesterState new_state;
+
+    if(event == ManchesterEventReset) {
+        new_state = ManchesterStateMid1;
+    } else {
+        new_state = (manchester_transitions[state] >> event) & 0x3;
+        if(new_state == state) {
+            new_state = ManchesterStateMid1;
+        } else if(new_state == ManchesterStateMid0) {
+            if(data) *data = false;
+            result = true;
+        } else if(new_state == ManchesterStateMid1) {
+            if(data) *data = true;
+            result = true;
+        }
+    }
+
+    *next_state = new_state;
+    return result;
+}
@@ -0,0 +1,25 @@
+// tools/host/shim/flipper_format/flipper_format.h
+#pragma once
+
+#include <furi.h>
+
+// Files are out of scope on the host: reads fail, writes to a string
+// FlipperFormat land in its text and writes to NULL succeed and go nowhere
+typedef struct FlipperFormat FlipperFormat;
+
+FlipperFormat* flipper_format_string_alloc(void);
+void flipper_format_free(FlipperFormat* flipper_format);
+/** Host only: "Key: value" lines written so far */
+const char* flipper_format_get_text(FlipperFormat* flipper_format);
+
+bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data);
+bool flipper_format_read_uint32(
+    FlipperFormat* flipper_format,
+    const char* key,
+    uint32_t* data,
+    uint16_t data_size);
+bool flipper_format_write_uint32(
+    FlipperFormat* flipper_format,
+    const char* key,
+    const uint32_t* data,
+    uint16_t data_size);
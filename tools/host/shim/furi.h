@@ -0,0 +1,59 @@
+// tools/host/shim/furi.h
+#pragma once
+
+// The slice of the furi API the shared decoders in protocols/ use, enough to
+// build them on a PC for the fuzz, golden and bench tools. Behaviour follows
+// the firmware where the decoders depend on it: malloc zero-fills.
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UNUSED(x)   (void)(x)
+#define COUNT_OF(x) (sizeof(x) / sizeof(x[0]))
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define CLAMP(x, upper, lower) (MIN(upper, MAX(x, lower)))
+
+void host_crash(const char* file, int line, const char* expression);
+
+#define furi_check(x)  ((x) ? (void)0 : host_crash(__FILE__, __LINE__, #x))
+#define furi_assert(x) furi_check(x)
+#define furi_crash(message) host_crash(__FILE__, __LINE__, message)
+
+#define FURI_LOG_E(tag, ...) ((void)(tag))
+#define FURI_LOG_W(tag, ...) ((void)(tag))
+#define FURI_LOG_I(tag, ...) ((void)(tag))
+#define FURI_LOG_D(tag, ...) ((void)(tag))
+
+// Firmware malloc never returns NULL and zero-fills, decoders rely on both
+void* host_malloc(size_t size);
+#define malloc(size) host_malloc(size)
+
+uint32_t furi_get_tick(void);
+uint32_t furi_kernel_get_tick_frequency(void);
+uint32_t furi_ms_to_ticks(uint32_t ms);
+
+typedef struct FuriString FuriString;
+
+FuriString* furi_string_alloc(void);
+void furi_string_free(FuriString* string);
+void furi_string_reset(FuriString* string);
+void furi_string_set(FuriString* string, const char* source);
+const char* furi_string_get_cstr(const FuriString* string);
+bool furi_string_equal(const FuriString* string, const char* cstr);
+void furi_string_cat_str(FuriString* string, const char* cstr);
+void furi_string_cat_printf(FuriString* string, const char* format, ...)
+    __attribute__((format(printf, 2, 3)));
+void furi_string_printf(FuriString* string, const char* format, ...)
+    __attribute__((format(printf, 2, 3)));
+
+// No records on the host, the trace ring stays closed
+bool furi_record_exists(const char* name);
+void* furi_record_open(const char* name);
+void furi_record_close(const char* name);
@@ -0,0 +1,13 @@
+// tools/host/shim/furi_hal.h
+#pragma once
+
+#include <furi.h>
+
+typedef struct {
+    volatile uint32_t CYCCNT;
+} HostDwt;
+
+// Trace stamps read it, it never moves on the host
+extern HostDwt* DWT;
+
+uint32_t furi_hal_cortex_instructions_per_microsecond(void);
@@ -0,0 +1,12 @@
+// tools/host/shim/lib/subghz/blocks/encoder.h
+#pragma once
+
+#include <lib/subghz/types.h>
+
+typedef struct {
+    bool is_running;
+    size_t repeat;
+    size_t front;
+    size_t size_upload;
+    LevelDuration* upload;
+} SubGhzProtocolBlockEncoder;
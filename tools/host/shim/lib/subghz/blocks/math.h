@@ -0,0 +1,11 @@
+// tools/host/shim/lib/subghz/blocks/math.h
+#pragma once
+
+#include <furi.h>
+
+#define bit_read(value, bit)  (((value) >> (bit)) & 0x01)
+#define bit_set(value, bit)   ((value) |= (1UL << (bit)))
+#define bit_clear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bit_write(value, bit, bitvalue) \
+    (bitvalue ? bit_set(value, bit) : bit_clear(value, bit))
+#define DURATION_DIFF(x, y) (((x) < (y)) ? ((y) - (x)) : ((x) - (y)))
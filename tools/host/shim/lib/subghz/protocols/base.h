@@ -0,0 +1,19 @@
+// tools/host/shim/lib/subghz/protocols/base.h
+#pragma once
+
+#include "../types.h"
+
+typedef struct SubGhzProtocolDecoderBase SubGhzProtocolDecoderBase;
+
+typedef void (
+    *SubGhzProtocolDecoderBaseRxCallback)(SubGhzProtocolDecoderBase* instance, void* context);
+
+struct SubGhzProtocolDecoderBase {
+    const SubGhzProtocol* protocol;
+    SubGhzProtocolDecoderBaseRxCallback callback;
+    void* context;
+};
+
+typedef struct {
+    const SubGhzProtocol* protocol;
+} SubGhzProtocolEncoderBase;
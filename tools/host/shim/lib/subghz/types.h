@@ -0,0 +1,99 @@
+// tools/host/shim/lib/subghz/types.h
+#pragma once
+
+#include <furi.h>
+#include <flipper_format/flipper_format.h>
+
+typedef struct {
+    uint32_t duration : 30;
+    uint8_t level     : 2;
+} LevelDuration;
+
+#define LEVEL_DURATION_RESET 0U
+
+static inline LevelDuration level_duration_make(bool level, uint32_t duration) {
+    LevelDuration level_duration;
+    level_duration.level = level ? 1 : 0;
+    level_duration.duration = duration;
+    return level_duration;
+}
+
+static inline LevelDuration level_duration_reset(void) {
+    LevelDuration level_duration;
+    level_duration.level = 2;
+    level_duration.duration = LEVEL_DURATION_RESET;
+    return level_duration;
+}
+
+typedef enum {
+    SubGhzProtocolFlag_RAW = (1 << 0),
+    SubGhzProtocolFlag_Decodable = (1 << 1),
+    SubGhzProtocolFlag_315 = (1 << 2),
+    SubGhzProtocolFlag_433 = (1 << 3),
+    SubGhzProtocolFlag_868 = (1 << 4),
+    SubGhzProtocolFlag_AM = (1 << 5),
+    SubGhzProtocolFlag_FM = (1 << 6),
+    SubGhzProtocolFlag_Save = (1 << 7),
+    SubGhzProtocolFlag_Load = (1 << 8),
+    SubGhzProtocolFlag_Send = (1 << 9),
+} SubGhzProtocolFlag;
+
+typedef enum {
+    SubGhzProtocolTypeUnknown = 0,
+    SubGhzProtocolTypeStatic,
+    SubGhzProtocolTypeDynamic,
+} SubGhzProtocolType;
+
+typedef enum {
+    SubGhzProtocolStatusOk = 0,
+    SubGhzProtocolStatusError = (-1),
+    SubGhzProtocolStatusErrorParserHeader = (-2),
+    SubGhzProtocolStatusErrorParserFrequency = (-3),
+    SubGhzProtocolStatusErrorParserPreset = (-4),
+    SubGhzProtocolStatusErrorParserOthers = (-5),
+    SubGhzProtocolStatusErrorValueBitCount = (-6),
+} SubGhzProtocolStatus;
+
+typedef struct SubGhzEnvironment SubGhzEnvironment;
+
+typedef struct {
+    FuriString* name;
+    uint32_t frequency;
+    uint8_t* data;
+    size_t data_size;
+} SubGhzRadioPreset;
+
+typedef struct {
+    void* (*alloc)(SubGhzEnvironment* environment);
+    void (*free)(void* decoder);
+    void (*feed)(void* decoder, bool level, uint32_t duration);
+    void (*reset)(void* decoder);
+    uint8_t (*get_hash_data)(void* decoder);
+    SubGhzProtocolStatus (*serialize)(
+        void* decoder,
+        FlipperFormat* flipper_format,
+        SubGhzRadioPreset* preset);
+    SubGhzProtocolStatus (*deserialize)(void* decoder, FlipperFormat* flipper_format);
+    void (*get_string)(void* decoder, FuriString* output);
+} SubGhzProtocolDecoder;
+
+typedef struct {
+    void* (*alloc)(SubGhzEnvironment* environment);
+    void (*free)(void* encoder);
+    SubGhzProtocolStatus (*deserialize)(void* encoder, FlipperFormat* flipper_format);
+    void (*stop)(void* encoder);
+    LevelDuration (*yield)(void* context);
+} SubGhzProtocolEncoder;
+
+typedef struct {
+    const char* name;
+    SubGhzProtocolType type;
+    SubGhzProtocolFlag flag;
+    const SubGhzProtocolEncoder* encoder;
+    const SubGhzProtocolDecoder* decoder;
+} SubGhzProtocol;
+
+typedef struct {
+    const SubGhzProtocol** items;
+    const size_t size;
+} SubGhzProtocolRegistry;
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Decode a ProtoPirate trace dump (trace.bin) into text.
+
+The layout is written by helpers/protopirate_trace.c: five little endian
+uint32 (magic "PPTR", version, record size, cycles per us, record count)
+followed by the records of protocols/protocol_trace.h:
+seq, time, event(u16), reserved(u16), arg[4].
+
+    python3 tools/protopirate_trace.py trace.bin
+"""
+
+import struct
+import sys
+
+MAGIC = 0x52545050
+VERSION = 1
+HEADER = struct.Struct("<5I")
+RECORD = struct.Struct("<IIHH4I")
+
+
+def raw(args):
+    return " ".join("%08X" % x for x in args)
+
+
+def hex64(args):
+    return "%08X%08X" % (args[0], args[1])
+
+
+# Mirrors ProtoPirateTraceEvent, id: (name, argument formatter)
+EVENTS = {
+    0x0101: ("KiaV1Sync", lambda a: "hdr=%u" % a[0]),
+    0x0102: ("KiaV1End", lambda a: "raw_bits=%u" % a[0]),
+    0x0103: (
+        "KiaV1Raw",
+        lambda a: "raw=%08X%04X raw_bits=%u" % (a[0], a[1], a[2]),
+    ),
+    0x0104: (
+        "KiaV1Best",
+        lambda a: "offset=%u bits=%u data=%08X%08X" % (a[0], a[1], a[2], a[3]),
+    ),
+    0x0105: (
+        "KiaV1Decode",
+        lambda a: "key=%s sn=%08X btn=%02X cnt=%02X"
+        % (hex64(a), a[2], a[3] >> 8, a[3] & 0xFF),
+    ),
+    0x0106: (
+        "KiaV1BadPulse",
+        lambda a: "%s %uus raw_bits=%u" % ("H" if a[0] else "L", a[1], a[2]),
+    ),
+    0x0201: (
+        "KiaV5Decode",
+        lambda a: "key=%s sn=%07X btn=%X" % (hex64(a), a[2], a[3]),
+    ),
+    0x1001: (
+        "ReceiverFrame",
+        lambda a: "hash=%02X %s history=%u"
+        % (a[0], "added" if a[1] else "dropped", a[2]),
+    ),
+}
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: %s trace.bin" % sys.argv[0])
+
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+
+    magic, version, size, cycles_per_us, count = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION or size != RECORD.size:
+        sys.exit("not a v%u trace dump" % VERSION)
+
+    start = None
+    previous = None
+    for i in range(count):
+        seq, time, event, _, *args = RECORD.unpack_from(data, HEADER.size + i * size)
+        # The cycle counter wraps every few tens of seconds, accumulate deltas
+        if start is None:
+            start = previous = time
+            elapsed = 0
+        else:
+            elapsed += (time - previous) & 0xFFFFFFFF
+            previous = time
+        name, formatter = EVENTS.get(event, ("0x%04X" % event, raw))
+        print(
+            "%8u %12.1f us  %-14s %s"
+            % (seq - 1, elapsed / cycles_per_us, name, formatter(args))
+        )
+
+
+if __name__ == "__main__":
+    main()
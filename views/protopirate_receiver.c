@@ -10,8 +10,15 @@
 #define MENU_ITEMS   4u
 #define UNLOCK_CNT   3
 
+#define STATUSBAR_FREQUENCY_LEN 10
+#define STATUSBAR_PRESET_LEN    4
+#define STATUSBAR_HISTORY_LEN   10
+
 typedef struct {
     FuriString* item_str;
+    // item_str elided to display_width px, refitted only when the width changes
+    FuriString* display_str;
+    uint8_t display_width;
     uint8_t type;
 } ProtoPirateReceiverMenuItem;
 
@@ -27,25 +34,62 @@ typedef struct {
     ProtoPirateReceiverMenuItemArray_t history_item_arr;
     uint8_t list_offset;
     uint8_t history_item;
-    float rssi;
-    FuriString* frequency_str;
-    FuriString* preset_str;
-    FuriString* history_stat_str;
+    uint8_t rssi_level;
+    char frequency_str[STATUSBAR_FREQUENCY_LEN];
+    char preset_str[STATUSBAR_PRESET_LEN];
+    char history_stat_str[STATUSBAR_HISTORY_LEN];
     bool external_radio;
     ProtoPirateLock lock;
     uint8_t lock_count;
+    ProtoPirateLatency* latency;
 } ProtoPirateReceiverModel;
 
+// Number of RSSI bars lit, the view only redraws when it changes
+static uint8_t protopirate_view_receiver_rssi_level(float rssi) {
+    if(rssi >= -60.0f) {
+        return 3;
+    } else if(rssi >= -70.0f) {
+        return 2;
+    } else if(rssi >= -80.0f) {
+        return 1;
+    }
+    return 0;
+}
+
 void protopirate_view_receiver_set_rssi(ProtoPirateReceiver* receiver, float rssi) {
     furi_assert(receiver);
+    uint8_t rssi_level = protopirate_view_receiver_rssi_level(rssi);
+    bool dirty = false;
     with_view_model(
-        receiver->view, ProtoPirateReceiverModel * model, { model->rssi = rssi; }, true);
+        receiver->view,
+        ProtoPirateReceiverModel * model,
+        {
+            dirty = model->rssi_level != rssi_level;
+            model->rssi_level = rssi_level;
+        },
+        dirty);
 }
 
 void protopirate_view_receiver_set_lock(ProtoPirateReceiver* receiver, ProtoPirateLock lock) {
     furi_assert(receiver);
+    bool dirty = false;
     with_view_model(
-        receiver->view, ProtoPirateReceiverModel * model, { model->lock = lock; }, true);
+        receiver->view,
+        ProtoPirateReceiverModel * model,
+        {
+            dirty = model->lock != lock;
+            model->lock = lock;
+        },
+        dirty);
+}
+
+static void protopirate_view_receiver_free_items(ProtoPirateReceiverModel* model) {
+    for(size_t i = 0; i < ProtoPirateReceiverMenuItemArray_size(model->history_item_arr); i++) {
+        ProtoPirateReceiverMenuItem* item =
+            ProtoPirateReceiverMenuItemArray_get(model->history_item_arr, i);
+        furi_string_free(item->item_str);
+        furi_string_free(item->display_str);
+    }
 }
 
 void protopirate_view_receiver_set_callback(
@@ -94,6 +138,8 @@ void protopirate_view_receiver_add_item_to_menu(
             ProtoPirateReceiverMenuItem* item_menu =
                 ProtoPirateReceiverMenuItemArray_push_raw(model->history_item_arr);
             item_menu->item_str = furi_string_alloc_set(name);
+            item_menu->display_str = furi_string_alloc();
+            item_menu->display_width = 0;
             item_menu->type = type;
         },
         true);
@@ -107,16 +153,24 @@ void protopirate_view_receiver_add_data_statusbar(
     const char* history_stat_str,
     bool external_radio) {
     furi_assert(receiver);
+    bool dirty = false;
     with_view_model(
         receiver->view,
         ProtoPirateReceiverModel * model,
         {
-            furi_string_set_str(model->frequency_str, frequency_str);
-            furi_string_set_str(model->preset_str, preset_str);
-            furi_string_set_str(model->history_stat_str, history_stat_str);
-            model->external_radio = external_radio;
+            dirty = strcmp(model->frequency_str, frequency_str) ||
+                    strcmp(model->preset_str, preset_str) ||
+                    strcmp(model->history_stat_str, history_stat_str) ||
+                    model->external_radio != external_radio;
+            if(dirty) {
+                strlcpy(model->frequency_str, frequency_str, sizeof(model->frequency_str));
+                strlcpy(model->preset_str, preset_str, sizeof(model->preset_str));
+                strlcpy(
+                    model->history_stat_str, history_stat_str, sizeof(model->history_stat_str));
+                model->external_radio = external_radio;
+            }
         },
-        true);
+        dirty);
 }
 
 static void protopirate_view_receiver_draw_frame(Canvas* canvas, uint16_t idx, bool scrollbar) {
@@ -136,29 +190,30 @@ static void protopirate_view_receiver_draw_frame(Canvas* canvas, uint16_t idx, b
 static void protopirate_view_receiver_draw_rssi(Canvas* canvas, ProtoPirateReceiverModel* model) {
     uint8_t x = 58;
     uint8_t y = 51;
-    float rssi = model->rssi;
 
-    if(rssi >= -60.0f) {
+    if(model->rssi_level >= 3) {
         canvas_draw_box(canvas, x + 8, y + 2, 4, 5);
     }
-    if(rssi >= -70.0f) {
+    if(model->rssi_level >= 2) {
         canvas_draw_box(canvas, x + 4, y + 4, 4, 3);
     }
-    if(rssi >= -80.0f) {
+    if(model->rssi_level >= 1) {
         canvas_draw_box(canvas, x, y + 6, 4, 1);
     }
 }
 
 void protopirate_view_receiver_draw(Canvas* canvas, ProtoPirateReceiverModel* model) {
+    if(model->latency) {
+        protopirate_latency_drawn(model->latency);
+    }
+
     canvas_clear(canvas);
     canvas_set_color(canvas, ColorBlack);
     canvas_set_font(canvas, FontSecondary);
 
     size_t item_count = ProtoPirateReceiverMenuItemArray_size(model->history_item_arr);
     bool scrollbar = item_count > MENU_ITEMS;
-
-    FuriString* str_buff;
-    str_buff = furi_string_alloc();
+    uint8_t max_width = scrollbar ? MAX_LEN_PX - 6 : MAX_LEN_PX;
 
     if(item_count > 0) {
         size_t shift_position = model->list_offset;
@@ -168,8 +223,11 @@ void protopirate_view_receiver_draw(Canvas* canvas, ProtoPirateReceiverModel* mo
             ProtoPirateReceiverMenuItem* item =
                 ProtoPirateReceiverMenuItemArray_get(model->history_item_arr, idx);
 
-            furi_string_set(str_buff, item->item_str);
-            elements_string_fit_width(canvas, str_buff, scrollbar ? MAX_LEN_PX - 6 : MAX_LEN_PX);
+            if(item->display_width != max_width) {
+                furi_string_set(item->display_str, item->item_str);
+                elements_string_fit_width(canvas, item->display_str, max_width);
+                item->display_width = max_width;
+            }
 
             if(model->history_item == idx) {
                 protopirate_view_receiver_draw_frame(canvas, i, scrollbar);
@@ -177,7 +235,8 @@ void protopirate_view_receiver_draw(Canvas* canvas, ProtoPirateReceiverModel* mo
                 canvas_set_color(canvas, ColorBlack);
             }
 
-            canvas_draw_str(canvas, 4, 9 + (i * FRAME_HEIGHT), furi_string_get_cstr(str_buff));
+            canvas_draw_str(
+                canvas, 4, 9 + (i * FRAME_HEIGHT), furi_string_get_cstr(item->display_str));
         }
 
         if(scrollbar) {
@@ -189,17 +248,14 @@ void protopirate_view_receiver_draw(Canvas* canvas, ProtoPirateReceiverModel* mo
         canvas_draw_str_aligned(canvas, 64, 38, AlignCenter, AlignCenter, "<- to Config");
     }
 
-    furi_string_free(str_buff);
-
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_line(canvas, 0, 48, 127, 48);
 
     // Draw status bar
     canvas_set_font(canvas, FontSecondary);
-    canvas_draw_str(canvas, 2, 58, furi_string_get_cstr(model->frequency_str));
-    canvas_draw_str(canvas, 40, 58, furi_string_get_cstr(model->preset_str));
-    canvas_draw_str_aligned(
-        canvas, 110, 58, AlignCenter, AlignBottom, furi_string_get_cstr(model->history_stat_str));
+    canvas_draw_str(canvas, 2, 58, model->frequency_str);
+    canvas_draw_str(canvas, 40, 58, model->preset_str);
+    canvas_draw_str_aligned(canvas, 110, 58, AlignCenter, AlignBottom, model->history_stat_str);
 
     // Draw RSSI
     protopirate_view_receiver_draw_rssi(canvas, model);
@@ -246,6 +302,11 @@ bool protopirate_view_receiver_input(InputEvent* event, void* context) {
             },
             true);
         consumed = true;
+    } else if(event->type == InputTypeLong && event->key == InputKeyOk) {
+        if(receiver->callback) {
+            receiver->callback(ProtoPirateCustomEventViewReceiverRecord, receiver->context);
+        }
+        consumed = true;
     } else if(event->type == InputTypeShort) {
         switch(event->key) {
         case InputKeyUp:
@@ -283,6 +344,9 @@ bool protopirate_view_receiver_input(InputEvent* event, void* context) {
             consumed = true;
             break;
         case InputKeyRight:
+            if(receiver->callback) {
+                receiver->callback(ProtoPirateCustomEventViewReceiverWaterfall, receiver->context);
+            }
             consumed = true;
             break;
         case InputKeyOk:
@@ -308,13 +372,7 @@ bool protopirate_view_receiver_input(InputEvent* event, void* context) {
                     receiver->view,
                     ProtoPirateReceiverModel * model,
                     {
-                        for(size_t i = 0;
-                            i < ProtoPirateReceiverMenuItemArray_size(model->history_item_arr);
-                            i++) {
-                            ProtoPirateReceiverMenuItem* item =
-                                ProtoPirateReceiverMenuItemArray_get(model->history_item_arr, i);
-                            furi_string_free(item->item_str);
-                        }
+                        protopirate_view_receiver_free_items(model);
                         ProtoPirateReceiverMenuItemArray_reset(model->history_item_arr);
                         model->history_item = 0;
                         model->list_offset = 0;
@@ -358,15 +416,16 @@ ProtoPirateReceiver* protopirate_view_receiver_alloc() {
         ProtoPirateReceiverModel * model,
         {
             ProtoPirateReceiverMenuItemArray_init(model->history_item_arr);
-            model->frequency_str = furi_string_alloc();
-            model->preset_str = furi_string_alloc();
-            model->history_stat_str = furi_string_alloc();
+            model->frequency_str[0] = '\0';
+            model->preset_str[0] = '\0';
+            model->history_stat_str[0] = '\0';
             model->list_offset = 0;
             model->history_item = 0;
-            model->rssi = -127.0f;
+            model->rssi_level = 0;
             model->external_radio = false;
             model->lock = ProtoPirateLockOff;
             model->lock_count = 0;
+            model->latency = NULL;
         },
         true);
 
@@ -380,16 +439,8 @@ void protopirate_view_receiver_free(ProtoPirateReceiver* receiver) {
         receiver->view,
         ProtoPirateReceiverModel * model,
         {
-            for(size_t i = 0; i < ProtoPirateReceiverMenuItemArray_size(model->history_item_arr);
-                i++) {
-                ProtoPirateReceiverMenuItem* item =
-                    ProtoPirateReceiverMenuItemArray_get(model->history_item_arr, i);
-                furi_string_free(item->item_str);
-            }
+            protopirate_view_receiver_free_items(model);
             ProtoPirateReceiverMenuItemArray_clear(model->history_item_arr);
-            furi_string_free(model->frequency_str);
-            furi_string_free(model->preset_str);
-            furi_string_free(model->history_stat_str);
         },
         false);
 
@@ -425,3 +476,11 @@ void protopirate_view_receiver_set_idx_menu(ProtoPirateReceiver* receiver, uint1
         true);
     protopirate_view_receiver_update_offset(receiver);
 }
+
+void protopirate_view_receiver_set_latency(
+    ProtoPirateReceiver* receiver,
+    ProtoPirateLatency* latency) {
+    furi_assert(receiver);
+    with_view_model(
+        receiver->view, ProtoPirateReceiverModel * model, { model->latency = latency; }, false);
+}
@@ -3,6 +3,7 @@
 
 #include <gui/view.h>
 #include "../helpers/protopirate_types.h"
+#include "../helpers/protopirate_latency.h"
 
 typedef struct ProtoPirateReceiver ProtoPirateReceiver;
 
@@ -33,3 +34,8 @@ uint16_t protopirate_view_receiver_get_idx_menu(ProtoPirateReceiver* receiver);
 void protopirate_view_receiver_set_idx_menu(ProtoPirateReceiver* receiver, uint16_t idx);
 void protopirate_view_receiver_set_rssi(ProtoPirateReceiver* receiver, float rssi);
 void protopirate_view_receiver_set_lock(ProtoPirateReceiver* receiver, ProtoPirateLock lock);
+
+/** Every draw closes the frame the latency tracer has pending */
+void protopirate_view_receiver_set_latency(
+    ProtoPirateReceiver* receiver,
+    ProtoPirateLatency* latency);
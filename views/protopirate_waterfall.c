@@ -0,0 +1,270 @@
+// views/protopirate_waterfall.c
+#include "protopirate_waterfall.h"
+#include "../helpers/protopirate_waterfall.h"
+#include <input/input.h>
+#include <gui/elements.h>
+#include <furi.h>
+
+#define WATERFALL_WIDTH  124
+#define WATERFALL_HEIGHT 48
+#define WATERFALL_STRIDE ((WATERFALL_WIDTH + 7) / 8)
+
+struct ProtoPirateWaterfallView {
+    View* view;
+    ProtoPirateWaterfallViewCallback callback;
+    void* context;
+};
+
+typedef struct {
+    // 1bpp XBM, the sweep head moves one column to the right per update
+    uint8_t raster[WATERFALL_STRIDE * WATERFALL_HEIGHT];
+    uint8_t column_x;
+    uint8_t row_count;
+    uint8_t cursor;
+    uint32_t frequency[PROTOPIRATE_WATERFALL_ROWS_MAX];
+    char preset[PROTOPIRATE_WATERFALL_ROWS_MAX][3];
+    int8_t last[PROTOPIRATE_WATERFALL_ROWS_MAX];
+    int8_t peak[PROTOPIRATE_WATERFALL_ROWS_MAX];
+} ProtoPirateWaterfallModel;
+
+// 2x2 ordered dither, level n lights n pixels out of 4
+static const uint8_t waterfall_dither[2][2] = {
+    {0, 2},
+    {3, 1},
+};
+
+void protopirate_view_waterfall_set_callback(
+    ProtoPirateWaterfallView* waterfall,
+    ProtoPirateWaterfallViewCallback callback,
+    void* context) {
+    furi_assert(waterfall);
+    waterfall->callback = callback;
+    waterfall->context = context;
+}
+
+static uint8_t protopirate_view_waterfall_level(int8_t rssi) {
+    // Same steps as the receiver RSSI bars, one more for the noise edge
+    if(rssi == PROTOPIRATE_WATERFALL_EMPTY) {
+        return 0;
+    } else if(rssi >= -60) {
+        return 4;
+    } else if(rssi >= -70) {
+        return 3;
+    } else if(rssi >= -80) {
+        return 2;
+    } else if(rssi >= -90) {
+        return 1;
+    }
+    return 0;
+}
+
+static void protopirate_view_waterfall_set_pixel(uint8_t* raster, uint8_t x, uint8_t y, bool on) {
+    uint8_t* byte = &raster[y * WATERFALL_STRIDE + x / 8];
+    uint8_t bit = 1 << (x % 8);
+    if(on) {
+        *byte |= bit;
+    } else {
+        *byte &= ~bit;
+    }
+}
+
+static void protopirate_view_waterfall_clear_column(uint8_t* raster, uint8_t x) {
+    for(uint8_t y = 0; y < WATERFALL_HEIGHT; y++) {
+        protopirate_view_waterfall_set_pixel(raster, x, y, false);
+    }
+}
+
+static void protopirate_view_waterfall_reset_model(
+    ProtoPirateWaterfallModel* model,
+    uint8_t row_count) {
+    memset(model->raster, 0, sizeof(model->raster));
+    model->column_x = 0;
+    model->row_count = CLAMP(row_count, PROTOPIRATE_WATERFALL_ROWS_MAX, 1);
+    if(model->cursor >= model->row_count) {
+        model->cursor = 0;
+    }
+    for(uint8_t i = 0; i < PROTOPIRATE_WATERFALL_ROWS_MAX; i++) {
+        model->frequency[i] = 0;
+        model->preset[i][0] = '\0';
+        model->last[i] = PROTOPIRATE_WATERFALL_EMPTY;
+        model->peak[i] = PROTOPIRATE_WATERFALL_EMPTY;
+    }
+}
+
+void protopirate_view_waterfall_reset(ProtoPirateWaterfallView* waterfall, uint8_t row_count) {
+    furi_assert(waterfall);
+    with_view_model(
+        waterfall->view,
+        ProtoPirateWaterfallModel * model,
+        { protopirate_view_waterfall_reset_model(model, row_count); },
+        true);
+}
+
+void protopirate_view_waterfall_set_row(
+    ProtoPirateWaterfallView* waterfall,
+    uint8_t row,
+    uint32_t frequency,
+    const char* preset_name) {
+    furi_assert(waterfall);
+    furi_assert(preset_name);
+    if(row >= PROTOPIRATE_WATERFALL_ROWS_MAX) return;
+
+    with_view_model(
+        waterfall->view,
+        ProtoPirateWaterfallModel * model,
+        {
+            model->frequency[row] = frequency;
+            strlcpy(model->preset[row], preset_name, sizeof(model->preset[row]));
+        },
+        false);
+}
+
+void protopirate_view_waterfall_add_column(
+    ProtoPirateWaterfallView* waterfall,
+    const int8_t* column,
+    uint8_t row_count) {
+    furi_assert(waterfall);
+    furi_assert(column);
+
+    with_view_model(
+        waterfall->view,
+        ProtoPirateWaterfallModel * model,
+        {
+            uint8_t rows = MIN(row_count, model->row_count);
+            uint8_t row_height = WATERFALL_HEIGHT / model->row_count;
+            uint8_t x = model->column_x;
+
+            // Only the newest column is rasterised, the rest of the map stays as is
+            for(uint8_t row = 0; row < rows; row++) {
+                if(column[row] != PROTOPIRATE_WATERFALL_EMPTY) {
+                    model->last[row] = column[row];
+                    model->peak[row] = MAX(model->peak[row], column[row]);
+                }
+                uint8_t level = protopirate_view_waterfall_level(column[row]);
+                for(uint8_t dy = 0; dy < row_height; dy++) {
+                    uint8_t y = row * row_height + dy;
+                    protopirate_view_waterfall_set_pixel(
+                        model->raster, x, y, level > waterfall_dither[y & 1][x & 1]);
+                }
+            }
+
+            // Blank the oldest column so the sweep head stays visible
+            model->column_x = (x + 1) % WATERFALL_WIDTH;
+            protopirate_view_waterfall_clear_column(model->raster, model->column_x);
+        },
+        true);
+}
+
+static void protopirate_view_waterfall_draw(Canvas* canvas, ProtoPirateWaterfallModel* model) {
+    canvas_clear(canvas);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_set_font(canvas, FontSecondary);
+
+    canvas_draw_xbm(canvas, 0, 0, WATERFALL_WIDTH, WATERFALL_HEIGHT, model->raster);
+
+    // Cursor marker next to the selected row
+    uint8_t row_height = WATERFALL_HEIGHT / model->row_count;
+    canvas_draw_box(canvas, WATERFALL_WIDTH + 1, model->cursor * row_height, 3, row_height);
+
+    canvas_draw_line(canvas, 0, 48, 127, 48);
+
+    char text_buf[24];
+    uint32_t frequency = model->frequency[model->cursor];
+    snprintf(
+        text_buf,
+        sizeof(text_buf),
+        "%03lu.%02lu %s",
+        frequency / 1000000 % 1000,
+        frequency / 10000 % 100,
+        model->preset[model->cursor]);
+    canvas_draw_str(canvas, 2, 58, text_buf);
+
+    int8_t last = model->last[model->cursor];
+    int8_t peak = model->peak[model->cursor];
+    if(last == PROTOPIRATE_WATERFALL_EMPTY) {
+        snprintf(text_buf, sizeof(text_buf), "---");
+    } else {
+        snprintf(text_buf, sizeof(text_buf), "%d/%d", last, peak);
+    }
+    canvas_draw_str_aligned(canvas, 126, 58, AlignRight, AlignBottom, text_buf);
+}
+
+static bool protopirate_view_waterfall_input(InputEvent* event, void* context) {
+    furi_assert(context);
+    ProtoPirateWaterfallView* waterfall = context;
+    bool consumed = false;
+
+    if(event->type != InputTypeShort && event->type != InputTypeRepeat) {
+        return false;
+    }
+
+    switch(event->key) {
+    case InputKeyUp:
+        with_view_model(
+            waterfall->view,
+            ProtoPirateWaterfallModel * model,
+            {
+                if(model->cursor > 0) {
+                    model->cursor--;
+                }
+            },
+            true);
+        consumed = true;
+        break;
+    case InputKeyDown:
+        with_view_model(
+            waterfall->view,
+            ProtoPirateWaterfallModel * model,
+            {
+                if(model->cursor + 1 < model->row_count) {
+                    model->cursor++;
+                }
+            },
+            true);
+        consumed = true;
+        break;
+    case InputKeyBack:
+    case InputKeyLeft:
+        if(event->type == InputTypeShort && waterfall->callback) {
+            waterfall->callback(ProtoPirateCustomEventViewWaterfallBack, waterfall->context);
+        }
+        consumed = true;
+        break;
+    default:
+        break;
+    }
+
+    return consumed;
+}
+
+ProtoPirateWaterfallView* protopirate_view_waterfall_alloc(void) {
+    ProtoPirateWaterfallView* waterfall = malloc(sizeof(ProtoPirateWaterfallView));
+
+    waterfall->view = view_alloc();
+    view_allocate_model(waterfall->view, ViewModelTypeLocking, sizeof(ProtoPirateWaterfallModel));
+    view_set_context(waterfall->view, waterfall);
+    view_set_draw_callback(waterfall->view, (ViewDrawCallback)protopirate_view_waterfall_draw);
+    view_set_input_callback(waterfall->view, protopirate_view_waterfall_input);
+
+    with_view_model(
+        waterfall->view,
+        ProtoPirateWaterfallModel * model,
+        {
+            model->cursor = 0;
+            protopirate_view_waterfall_reset_model(model, 1);
+        },
+        true);
+
+    return waterfall;
+}
+
+void protopirate_view_waterfall_free(ProtoPirateWaterfallView* waterfall) {
+    furi_assert(waterfall);
+    view_free(waterfall->view);
+    free(waterfall);
+}
+
+View* protopirate_view_waterfall_get_view(ProtoPirateWaterfallView* waterfall) {
+    furi_assert(waterfall);
+    return waterfall->view;
+}
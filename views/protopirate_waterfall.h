@@ -0,0 +1,34 @@
+// views/protopirate_waterfall.h
+#pragma once
+
+#include <gui/view.h>
+#include "../helpers/protopirate_types.h"
+
+typedef struct ProtoPirateWaterfallView ProtoPirateWaterfallView;
+
+typedef void (*ProtoPirateWaterfallViewCallback)(ProtoPirateCustomEvent event, void* context);
+
+void protopirate_view_waterfall_set_callback(
+    ProtoPirateWaterfallView* waterfall,
+    ProtoPirateWaterfallViewCallback callback,
+    void* context);
+
+ProtoPirateWaterfallView* protopirate_view_waterfall_alloc(void);
+void protopirate_view_waterfall_free(ProtoPirateWaterfallView* waterfall);
+View* protopirate_view_waterfall_get_view(ProtoPirateWaterfallView* waterfall);
+
+/** Clear the map and set up one row per hopper step */
+void protopirate_view_waterfall_reset(ProtoPirateWaterfallView* waterfall, uint8_t row_count);
+
+/** Label of a row shown in the footer when the cursor is on it */
+void protopirate_view_waterfall_set_row(
+    ProtoPirateWaterfallView* waterfall,
+    uint8_t row,
+    uint32_t frequency,
+    const char* preset_name);
+
+/** Rasterise one new column, row_count dBm values */
+void protopirate_view_waterfall_add_column(
+    ProtoPirateWaterfallView* waterfall,
+    const int8_t* column,
+    uint8_t row_count);